@@ -1,10 +1,15 @@
 #include "AStarAlgorithm.h"
 #include "Utils.h"
 #include "EngineConfig.h"
+#include "Profiler.h"
+#include "Counters.h"
+#include "AllocationTracker.h"
 #include <cmath>
 #include <iostream>
 #include <algorithm>
 
+static Counter nodesExpanded("A* nodes expanded");
+
 AStarAlgorithm::AStarAlgorithm() : searchSpace(nullptr), algorithmState(AlgorithmState::NONE), searchResult(SearchResult::NONE_SR) {
 
 }
@@ -25,6 +30,8 @@ bool AStarAlgorithm::isSearching() {
 
 // search for path
 SearchResult AStarAlgorithm::search() {
+	PROFILE_FUNCTION();
+	MEMORY_SCOPE(MemoryTag::PATHFINDING);
 	// set AlgorithmState
 	setAlgorithmState(AlgorithmState::SEARCHING);
 
@@ -47,6 +54,7 @@ SearchResult AStarAlgorithm::search() {
 
 		openSet.pop();
 		closedSet.push_back(node);
+		nodesExpanded.add();
 
 		if (node == *FINAL_NODE) {
 			// set AlgorithmState
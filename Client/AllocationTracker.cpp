@@ -0,0 +1,226 @@
+#include "AllocationTracker.h"
+#include "Counters.h"
+#include "Profiler.h"
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+// stored in front of every tracked block
+struct AllocationHeader {
+	size_t size;
+	MemoryTag tag;
+};
+
+static_assert(sizeof(AllocationHeader) <= ALLOCATION_HEADER_SIZE, "allocation header does not fit");
+
+static Counter allocatedBytes[(int)MemoryTag::COUNT] = {
+	{ "Allocated bytes general" },
+	{ "Allocated bytes renderer" },
+	{ "Allocated bytes sprites" },
+	{ "Allocated bytes textures" },
+	{ "Allocated bytes edges" },
+	{ "Allocated bytes lights" },
+	{ "Allocated bytes pathfinding" }
+};
+
+static Counter allocationNumbers[(int)MemoryTag::COUNT] = {
+	{ "Allocations general" },
+	{ "Allocations renderer" },
+	{ "Allocations sprites" },
+	{ "Allocations textures" },
+	{ "Allocations edges" },
+	{ "Allocations lights" },
+	{ "Allocations pathfinding" }
+};
+
+// names of the profiler values, live bytes are a level and can't be summed by a counter
+static const char* liveValueNames[(int)MemoryTag::COUNT] = {
+	"Live bytes general",
+	"Live bytes renderer",
+	"Live bytes sprites",
+	"Live bytes textures",
+	"Live bytes edges",
+	"Live bytes lights",
+	"Live bytes pathfinding"
+};
+
+static const char* frameValueNames[(int)MemoryTag::COUNT] = {
+	"Frame bytes general",
+	"Frame bytes renderer",
+	"Frame bytes sprites",
+	"Frame bytes textures",
+	"Frame bytes edges",
+	"Frame bytes lights",
+	"Frame bytes pathfinding"
+};
+
+// atomics are zero before any constructor runs, so allocations of static initialization are counted too
+std::atomic<long long> AllocationTracker::liveBytes[(int)MemoryTag::COUNT];
+std::atomic<long long> AllocationTracker::peakBytes[(int)MemoryTag::COUNT];
+std::atomic<long long> AllocationTracker::totalBytes[(int)MemoryTag::COUNT];
+std::atomic<long long> AllocationTracker::totalAllocations[(int)MemoryTag::COUNT];
+MemoryStats AllocationTracker::stats[(int)MemoryTag::COUNT];
+thread_local MemoryTag AllocationTracker::currentTag = MemoryTag::GENERAL;
+int AllocationTracker::printMarker = 0;
+
+// allocate / deallocate
+void* AllocationTracker::allocate(size_t size) {
+	unsigned char* block = (unsigned char*)std::malloc(size + ALLOCATION_HEADER_SIZE);
+	if (block == nullptr) {
+		return nullptr;
+	}
+
+	AllocationHeader* header = (AllocationHeader*)block;
+	header->size = size;
+	header->tag = currentTag;
+
+	int tag = (int)header->tag;
+	long long live = liveBytes[tag].fetch_add((long long)size, std::memory_order_relaxed) + (long long)size;
+	totalBytes[tag].fetch_add((long long)size, std::memory_order_relaxed);
+	totalAllocations[tag].fetch_add(1, std::memory_order_relaxed);
+
+	long long peak = peakBytes[tag].load(std::memory_order_relaxed);
+	while (live > peak && !peakBytes[tag].compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+
+	}
+
+	return block + ALLOCATION_HEADER_SIZE;
+}
+
+void AllocationTracker::deallocate(void* pointer) {
+	if (pointer == nullptr) {
+		return;
+	}
+
+	unsigned char* block = (unsigned char*)pointer - ALLOCATION_HEADER_SIZE;
+	AllocationHeader* header = (AllocationHeader*)block;
+	liveBytes[(int)header->tag].fetch_sub((long long)header->size, std::memory_order_relaxed);
+
+	std::free(block);
+}
+
+// frame
+void AllocationTracker::endFrame() {
+	for (int i = 0; i < (int)MemoryTag::COUNT; i++) {
+		MemoryStats& tagStats = stats[i];
+		long long bytes = totalBytes[i].load(std::memory_order_relaxed);
+		long long allocations = totalAllocations[i].load(std::memory_order_relaxed);
+
+		// counters keep per frame amounts, so only what was allocated since the last frame is added
+		tagStats.frameBytes = bytes - allocatedBytes[i].getTotal();
+		tagStats.frameAllocations = allocations - allocationNumbers[i].getTotal();
+		allocatedBytes[i].add(tagStats.frameBytes);
+		allocationNumbers[i].add(tagStats.frameAllocations);
+
+		bool overBudget = tagStats.budget > 0 && tagStats.liveBytes > tagStats.budget;
+		tagStats.liveBytes = liveBytes[i].load(std::memory_order_relaxed);
+		tagStats.peakBytes = peakBytes[i].load(std::memory_order_relaxed);
+
+		// shown as counter tracks in the trace and as averages in the profiler summary
+		Profiler::addValue(liveValueNames[i], tagStats.liveBytes);
+		Profiler::addValue(frameValueNames[i], tagStats.frameBytes);
+
+		// logged once when the budget is crossed, not every frame it stays above it
+		if (!overBudget && tagStats.budget > 0 && tagStats.liveBytes > tagStats.budget) {
+			std::cout << "Memory budget of " << getTagName((MemoryTag)i) << " exceeded: " << tagStats.liveBytes << " / " << tagStats.budget << " bytes" << std::endl;
+		}
+	}
+}
+
+void AllocationTracker::printSummary() {
+	if (++printMarker < ALLOCATION_PRINT_INTERVAL) {
+		return;
+	}
+	printMarker = 0;
+
+	for (int i = 0; i < (int)MemoryTag::COUNT; i++) {
+		const MemoryStats& tagStats = stats[i];
+		std::cout << getTagName((MemoryTag)i) << " live: " << tagStats.liveBytes << ", peak: " << tagStats.peakBytes;
+		std::cout << ", frame: " << tagStats.frameBytes << " bytes in " << tagStats.frameAllocations << " allocations" << std::endl;
+	}
+}
+
+// setters
+void AllocationTracker::setTag(MemoryTag tag) {
+	currentTag = tag;
+}
+
+void AllocationTracker::setBudget(MemoryTag tag, long long bytes) {
+	// 0 removes the budget
+	stats[(int)tag].budget = bytes;
+}
+
+// getters
+MemoryTag AllocationTracker::getTag() {
+	return currentTag;
+}
+
+const MemoryStats& AllocationTracker::getStats(MemoryTag tag) {
+	return stats[(int)tag];
+}
+
+const char* AllocationTracker::getTagName(MemoryTag tag) {
+	switch (tag) {
+	case MemoryTag::RENDERER:
+		return "Renderer";
+	case MemoryTag::SPRITES:
+		return "Sprites";
+	case MemoryTag::TEXTURES:
+		return "Textures";
+	case MemoryTag::EDGES:
+		return "Edges";
+	case MemoryTag::LIGHTS:
+		return "Lights";
+	case MemoryTag::PATHFINDING:
+		return "Pathfinding";
+	default:
+		return "General";
+	}
+}
+
+#if ALLOCATION_TRACKING
+// global new / delete, every C++ allocation of the game goes through the tracker
+void* operator new(size_t size) {
+	void* pointer = AllocationTracker::allocate(size);
+	if (pointer == nullptr) {
+		throw std::bad_alloc();
+	}
+	return pointer;
+}
+
+void* operator new[](size_t size) {
+	return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+	return AllocationTracker::allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+	return AllocationTracker::allocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+	AllocationTracker::deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+	AllocationTracker::deallocate(pointer);
+}
+
+void operator delete(void* pointer, size_t /*size*/) noexcept {
+	AllocationTracker::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, size_t /*size*/) noexcept {
+	AllocationTracker::deallocate(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+	AllocationTracker::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+	AllocationTracker::deallocate(pointer);
+}
+#endif
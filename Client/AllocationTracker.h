@@ -0,0 +1,84 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+// 0 leaves global new / delete to the runtime
+#define ALLOCATION_TRACKING 1
+// size and tag are stored in front of every block, 16 bytes keep blocks aligned as malloc does
+#define ALLOCATION_HEADER_SIZE 16
+#define ALLOCATION_PRINT_INTERVAL 600
+
+// subsystem an allocation is charged to, set for the calling thread with MEMORY_SCOPE
+enum class MemoryTag {
+	GENERAL,
+	RENDERER,
+	SPRITES,
+	TEXTURES,
+	EDGES,
+	LIGHTS,
+	PATHFINDING,
+	COUNT
+};
+
+// bytes of one tag, frame values are the amounts allocated during the last frame
+struct MemoryStats {
+	long long liveBytes;
+	long long peakBytes;
+	long long frameBytes;
+	long long frameAllocations;
+	long long budget;
+};
+
+// Charges every allocation made through global new to the tag of the calling thread. Blocks
+// remember their tag, so they are freed from the right tag wherever they are deleted. Totals
+// are atomics, endFrame() turns them into per frame amounts and reports them to Counters and the Profiler.
+class AllocationTracker
+{
+private:
+	static std::atomic<long long> liveBytes[(int)MemoryTag::COUNT];
+	static std::atomic<long long> peakBytes[(int)MemoryTag::COUNT];
+	static std::atomic<long long> totalBytes[(int)MemoryTag::COUNT];
+	static std::atomic<long long> totalAllocations[(int)MemoryTag::COUNT];
+	static MemoryStats stats[(int)MemoryTag::COUNT];
+	static thread_local MemoryTag currentTag;
+	static int printMarker;
+public:
+	// allocate / deallocate
+	static void* allocate(size_t size);
+	static void deallocate(void* pointer);
+
+	// frame
+	static void endFrame();
+	static void printSummary();
+
+	// setters
+	static void setTag(MemoryTag tag);
+	static void setBudget(MemoryTag tag, long long bytes);
+
+	// getters
+	static MemoryTag getTag();
+	static const MemoryStats& getStats(MemoryTag tag);
+	static const char* getTagName(MemoryTag tag);
+};
+
+// charges allocations of its scope to a tag, the previous tag is restored at the end
+class MemoryScope
+{
+private:
+	MemoryTag previousTag;
+public:
+	MemoryScope(MemoryTag tag);
+	~MemoryScope();
+};
+
+inline MemoryScope::MemoryScope(MemoryTag tag) : previousTag(AllocationTracker::getTag()) {
+	AllocationTracker::setTag(tag);
+}
+
+inline MemoryScope::~MemoryScope() {
+	AllocationTracker::setTag(previousTag);
+}
+
+#define MEMORY_CONCAT_LINE(name, line) name##line
+#define MEMORY_CONCAT(name, line) MEMORY_CONCAT_LINE(name, line)
+#define MEMORY_SCOPE(tag) MemoryScope MEMORY_CONCAT(memoryScope, __LINE__)(tag)
@@ -1,6 +1,6 @@
 #include "Camera2D.h"
 
-Camera2D::Camera2D(float halfWidth, float halfHeight, float cameraX, float cameraY) : halfWidth(halfWidth), halfHeight(halfHeight), position(cameraX, cameraY), cameraMatrix(1.0f), orthoMatrix(1.0f), scale(1.0f), change(true) {
+Camera2D::Camera2D(float halfWidth, float halfHeight, float cameraX, float cameraY) : halfWidth(halfWidth), halfHeight(halfHeight), position(cameraX, cameraY), cameraMatrix(1.0f), orthoMatrix(1.0f), scale(1.0f), change(true), version(0) {
 	init();
 }
 
@@ -21,6 +21,8 @@ void Camera2D::update() {
 		glm::vec3 translate(-position.x, -position.y, 0.0f);
 		cameraMatrix = glm::translate(orthoMatrix, translate);
 
+		// lets uniform buffers know that the matrix has to be uploaded again
+		version++;
 		change = false;
 	}
 }
@@ -38,8 +40,11 @@ glm::vec2 Camera2D::convertScreenToWorld(glm::vec2 screenCoords) {
 	return screenCoords;
 }
 
-bool Camera2D::isBlockInView(float x, float y, float width, float height) {
-	return false;
+bool Camera2D::isBlockInView(float x, float y, float width, float height) const {
+	glm::vec2 min = bounds.getPosition();
+	glm::vec2 max = min + bounds.getDimensions();
+
+	return x <= max.x && y <= max.y && x + width >= min.x && y + height >= min.y;
 }
 
 void Camera2D::setPosition(const glm::vec2& position) {
@@ -48,7 +53,11 @@ void Camera2D::setPosition(const glm::vec2& position) {
 }
 
 void Camera2D::updateBounds() {
-	bounds.setPosition(glm::vec2(position.x - halfWidth, position.y - halfHeight));
+	// zoom changes how much of the world fits on the screen
+	glm::vec2 halfSize = glm::vec2(halfWidth, halfHeight) * scale;
+
+	bounds.setDimensions(halfSize * 2.0f);
+	bounds.setPosition(position - halfSize);
 }
 
 void Camera2D::setDimiension(float halfWidth, float halfHeight) {
@@ -90,3 +99,15 @@ float Camera2D::getScale() {
 Square Camera2D::getBounds() const {
 	return bounds;
 }
+
+int Camera2D::getVersion() const {
+	return version;
+}
+
+int Camera2D::getScreenWidth() const {
+	return 2 * halfWidth;
+}
+
+int Camera2D::getScreenHeight() const {
+	return 2 * halfHeight;
+}
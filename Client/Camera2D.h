@@ -13,12 +13,13 @@ private:
 	int halfWidth;
 	int halfHeight;
 	bool change;
+	int version;
 public:
 	Camera2D(float halfWidth, float halfHeight, float cameraX, float cameraY);
 	glm::vec2 convertScreenToWorld(glm::vec2 screenCoords);
 	void reset(glm::vec2 position);
 	void update();
-	bool isBlockInView(float x, float y, float width, float height);
+	bool isBlockInView(float x, float y, float width, float height) const;
 	// setters
 	void setPosition(const glm::vec2& position);
 	void setDimiension(float halfWidth, float halfHeight);
@@ -29,6 +30,9 @@ public:
 	glm::mat4& getCameraReference();
 	float getScale();
 	Square getBounds() const;
+	int getVersion() const;
+	int getScreenWidth() const;
+	int getScreenHeight() const;
 private:
 	void init();
 	void updateOrthoMatrix();
@@ -0,0 +1,44 @@
+#include "CameraBuffer.h"
+#include "GLState.h"
+#include "GraphicsBackend.h"
+
+CameraBuffer::CameraBuffer() : bufferID(0), camera(nullptr), version(-1) {
+
+}
+
+// init
+void CameraBuffer::init(Camera2D& camera) {
+	if (check()) {
+		this->camera = &camera;
+
+		GraphicsBackend::get().genBuffers(1, &bufferID);
+		GLState::bindBuffer(GL_UNIFORM_BUFFER, bufferID);
+		GraphicsBackend::get().bufferData(GL_UNIFORM_BUFFER, sizeof(glm::mat4), nullptr, GL_DYNAMIC_DRAW);
+		GraphicsBackend::get().bindBufferBase(GL_UNIFORM_BUFFER, CAMERA_BLOCK_BINDING, bufferID);
+		GLState::bindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+}
+
+// upload
+void CameraBuffer::upload() {
+	// version changes only when Camera2D::update recalculates the matrix
+	if (camera->getVersion() == version) {
+		return;
+	}
+
+	version = camera->getVersion();
+
+	GLState::bindBuffer(GL_UNIFORM_BUFFER, bufferID);
+	GraphicsBackend::get().bufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(glm::mat4), &camera->getCameraReference()[0][0]);
+	GLState::bindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+// getters
+GLuint CameraBuffer::getBufferID() const {
+	return bufferID;
+}
+
+// helper
+bool CameraBuffer::check() {
+	return bufferID == 0;
+}
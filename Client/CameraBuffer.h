@@ -0,0 +1,31 @@
+#pragma once
+#include "Camera2D.h"
+#include <GL/glew.h>
+
+#define CAMERA_BLOCK_BINDING 1
+#define CAMERA_BLOCK_NAME "Camera"
+
+// Uniform buffer with the camera matrix, shared by every program which declares the Camera block.
+// The matrix is uploaded only when the camera was changed since the last upload.
+class CameraBuffer
+{
+private:
+	GLuint bufferID;
+	Camera2D* camera;
+	int version;
+public:
+	// constructors
+	CameraBuffer();
+
+	// init
+	void init(Camera2D& camera);
+
+	// upload
+	void upload();
+
+	// getters
+	GLuint getBufferID() const;
+private:
+	// helper
+	bool check();
+};
@@ -0,0 +1,134 @@
+#include "Counters.h"
+#include <fstream>
+#include <iostream>
+
+Counter::Counter(const char* name) : name(name), shards(), lastTotal(0) {
+	Counters::add(this);
+}
+
+// getters
+const char* Counter::getName() const {
+	return name;
+}
+
+long long Counter::getTotal() const {
+	long long total = 0;
+	for (int i = 0; i < COUNTER_SHARDS; i++) {
+		total = total + shards[i].value.load(std::memory_order_relaxed);
+	}
+	return total;
+}
+
+std::mutex Counters::mutex;
+std::vector<CounterFrame> Counters::history;
+int Counters::head = 0;
+int Counters::frame = 0;
+int Counters::printMarker = 0;
+
+// register
+void Counters::add(Counter* counter) {
+	// counters are registered during static initialization, the mutex may not be constructed yet
+	getCounters().push_back(counter);
+}
+
+// snapshot
+void Counters::snapshot() {
+	std::lock_guard<std::mutex> lock(mutex);
+	std::vector<Counter*>& counters = getCounters();
+
+	if (history.size() < COUNTER_HISTORY) {
+		history.emplace_back();
+	}
+
+	// oldest frame is overwritten, its vector keeps the memory
+	CounterFrame& counterFrame = history[head];
+	counterFrame.frame = frame++;
+	counterFrame.values.resize(counters.size());
+
+	for (size_t i = 0; i < counters.size(); i++) {
+		long long total = counters[i]->getTotal();
+		counterFrame.values[i] = total - counters[i]->lastTotal;
+		counters[i]->lastTotal = total;
+	}
+
+	head = (head + 1) % COUNTER_HISTORY;
+}
+
+void Counters::printSnapshot() {
+	if (++printMarker < COUNTER_PRINT_INTERVAL) {
+		return;
+	}
+	printMarker = 0;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	const CounterFrame* counterFrame = getLastFrame();
+	if (counterFrame == nullptr) {
+		return;
+	}
+
+	std::vector<Counter*>& counters = getCounters();
+	for (size_t i = 0; i < counterFrame->values.size(); i++) {
+		std::cout << counters[i]->getName() << ": " << counterFrame->values[i] << std::endl;
+	}
+}
+
+bool Counters::exportCSV(const std::string& filePath) {
+	std::ofstream file(filePath);
+	if (file.fail()) {
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	std::vector<Counter*>& counters = getCounters();
+
+	file << "frame";
+	for (size_t i = 0; i < counters.size(); i++) {
+		file << "," << counters[i]->getName();
+	}
+	file << std::endl;
+
+	// ring starts at head once it is full, frames are written from the oldest one
+	int first = history.size() < COUNTER_HISTORY ? 0 : head;
+	for (size_t i = 0; i < history.size(); i++) {
+		const CounterFrame& counterFrame = history[(first + i) % history.size()];
+
+		file << counterFrame.frame;
+		for (size_t j = 0; j < counters.size(); j++) {
+			file << "," << (j < counterFrame.values.size() ? counterFrame.values[j] : 0);
+		}
+		file << std::endl;
+	}
+
+	return !file.fail();
+}
+
+// getters
+long long Counters::getValue(const std::string& name) {
+	std::lock_guard<std::mutex> lock(mutex);
+	const CounterFrame* counterFrame = getLastFrame();
+	if (counterFrame == nullptr) {
+		return 0;
+	}
+
+	std::vector<Counter*>& counters = getCounters();
+	for (size_t i = 0; i < counterFrame->values.size(); i++) {
+		if (name == counters[i]->getName()) {
+			return counterFrame->values[i];
+		}
+	}
+	return 0;
+}
+
+// helper
+std::vector<Counter*>& Counters::getCounters() {
+	// constructed on first use, counters of other files may register before statics of this one
+	static std::vector<Counter*> counters;
+	return counters;
+}
+
+const CounterFrame* Counters::getLastFrame() {
+	if (history.empty()) {
+		return nullptr;
+	}
+	return &history[(head + COUNTER_HISTORY - 1) % COUNTER_HISTORY];
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// shards of every counter, threads are spread over them so they don't write the same cache line
+#define COUNTER_SHARDS 16
+#define CACHE_LINE_SIZE 64
+// frames kept in the time series
+#define COUNTER_HISTORY 600
+#define COUNTER_PRINT_INTERVAL 600
+
+struct alignas(CACHE_LINE_SIZE) CounterShard {
+	std::atomic<long long> value;
+};
+
+// Number counted by a subsystem, defined as a static object in its source file. add() is one relaxed
+// atomic add on the shard of the calling thread, counters are summed once per frame by snapshot().
+class Counter
+{
+private:
+	const char* name;
+	CounterShard shards[COUNTER_SHARDS];
+	long long lastTotal;
+public:
+	// constructors
+	Counter(const char* name);
+
+	// add
+	void add(long long amount = 1);
+
+	// getters
+	const char* getName() const;
+	long long getTotal() const;
+
+	friend class Counters;
+};
+
+// one snapshot of every counter, values are the amounts counted during the frame
+struct CounterFrame {
+	int frame;
+	std::vector<long long> values;
+};
+
+// Registry of counters. snapshot() is called once per frame by the game and appends the frame
+// to a ring of COUNTER_HISTORY frames, which can be printed or written to CSV.
+class Counters
+{
+private:
+	static std::mutex mutex;
+	static std::vector<CounterFrame> history;
+	static int head;
+	static int frame;
+	static int printMarker;
+public:
+	// register
+	static void add(Counter* counter);
+
+	// snapshot
+	static void snapshot();
+	static void printSnapshot();
+	static bool exportCSV(const std::string& filePath);
+
+	// getters
+	static long long getValue(const std::string& name);
+	static int getShard();
+private:
+	// helper
+	static std::vector<Counter*>& getCounters();
+	static const CounterFrame* getLastFrame();
+};
+
+// add
+inline void Counter::add(long long amount) {
+	shards[Counters::getShard()].value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+// getters
+inline int Counters::getShard() {
+	// shards are handed out to threads in turn, the first time a thread counts anything
+	static std::atomic<int> nextShard(0);
+	static thread_local int shard = nextShard++ % COUNTER_SHARDS;
+	return shard;
+}
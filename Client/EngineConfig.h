@@ -23,6 +23,24 @@ static const std::string MULTI_VISION_GEOMETRY_FRAGMENT_PATH = "Shaders/multiVis
 static const std::string MULTI_VISION_TEXTURE_VERTEX_PATH = "Shaders/multiVisionTextureShader.vert";
 static const std::string MULTI_VISION_TEXTURE_FRAGMENT_PATH = "Shaders/multiVisionTextureShader.frag";
 
+// instanced shaders, vertex shader is shared with all fragment shaders above
+static const std::string INSTANCE_VERTEX_PATH = "Shaders/instanceShader.vert";
+
+// instanced texture shaders sample texture arrays, layer comes from instance data
+static const std::string TEXTURE_ARRAY_FRAGMENT_PATH = "Shaders/textureArrayShader.frag";
+static const std::string VISION_TEXTURE_ARRAY_FRAGMENT_PATH = "Shaders/visionTextureArrayShader.frag";
+static const std::string MULTI_VISION_TEXTURE_ARRAY_FRAGMENT_PATH = "Shaders/multiVisionTextureArrayShader.frag";
+
+// static geometry restores positions from the bounds of the static buffer, fragment shaders are the geometry ones
+static const std::string STATIC_GEOMETRY_VERTEX_PATH = "Shaders/staticGeometryShader.vert";
+
+// baked lights, vertex shader is the texture one
+static const std::string LIGHTMAP_FRAGMENT_PATH = "Shaders/lightmapShader.frag";
+
+// light accumulation buffer is upsampled to the screen by one fullscreen triangle
+static const std::string COMPOSITE_VERTEX_PATH = "Shaders/compositeShader.vert";
+static const std::string COMPOSITE_FRAGMENT_PATH = "Shaders/compositeShader.frag";
+
 // shader attributes
 static const std::string VERTEX_POSITION = "vertexPosition";
 static const std::string VERTEX_COLOR = "vertexColor";
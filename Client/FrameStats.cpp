@@ -0,0 +1,162 @@
+#include "FrameStats.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+
+FrameStats::FrameStats() : buckets(), hitches(), previousTime(0), totalTime(0), maxTime(0.0), lastTime(0.0), frames(0), hitchCount(0), printMarker(0), logging(true) {
+
+}
+
+// update
+void FrameStats::update() {
+	long long currentTime = Profiler::now();
+
+	// first call only starts the clock
+	if (previousTime != 0) {
+		addFrame((currentTime - previousTime) / NANOSECONDS_PER_MILISECOND);
+	}
+	previousTime = currentTime;
+}
+
+void FrameStats::addFrame(double frameTime) {
+	// hitch is compared to the median before this frame is added
+	detectHitch(frameTime);
+
+	int bucket = (int)(frameTime / FRAME_STATS_BUCKET_WIDTH);
+	buckets[std::min(std::max(bucket, 0), FRAME_STATS_BUCKETS - 1)]++;
+
+	totalTime = totalTime + (long long)(frameTime * NANOSECONDS_PER_MILISECOND);
+	maxTime = std::max(maxTime, frameTime);
+	lastTime = frameTime;
+	frames++;
+}
+
+void FrameStats::reset() {
+	std::fill(buckets, buckets + FRAME_STATS_BUCKETS, 0);
+	hitches.clear();
+	totalTime = 0;
+	maxTime = 0.0;
+	lastTime = 0.0;
+	frames = 0;
+	hitchCount = 0;
+}
+
+// print
+void FrameStats::printSummary() {
+	if (++printMarker < FRAME_STATS_PRINT_INTERVAL) {
+		return;
+	}
+	printMarker = 0;
+
+	std::streamsize precision = std::cout.precision();
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "Frame ms p50: " << getPercentile(50.0) << ", p95: " << getPercentile(95.0) << ", p99: " << getPercentile(99.0);
+	std::cout << ", max: " << maxTime << ", hitches: " << hitchCount << std::endl;
+	std::cout.unsetf(std::ios::floatfield);
+	std::cout.precision(precision);
+}
+
+// setters
+void FrameStats::setLogging(bool logging) {
+	this->logging = logging;
+}
+
+// getters
+double FrameStats::getPercentile(double percentile) const {
+	if (frames == 0) {
+		return 0.0;
+	}
+
+	// upper edge of the bucket which holds the percentile, the last bucket is bounded by max
+	int target = (int)(frames * percentile / 100.0 + 0.5);
+	int count = 0;
+
+	for (int i = 0; i < FRAME_STATS_BUCKETS - 1; i++) {
+		count = count + buckets[i];
+		if (count >= target) {
+			return std::min((i + 1) * FRAME_STATS_BUCKET_WIDTH, maxTime);
+		}
+	}
+	return maxTime;
+}
+
+double FrameStats::getAverage() const {
+	if (frames == 0) {
+		return 0.0;
+	}
+	return totalTime / NANOSECONDS_PER_MILISECOND / frames;
+}
+
+double FrameStats::getMax() const {
+	return maxTime;
+}
+
+double FrameStats::getLastTime() const {
+	return lastTime;
+}
+
+int FrameStats::getFrameCount() const {
+	return frames;
+}
+
+int FrameStats::getHitchCount() const {
+	return hitchCount;
+}
+
+const std::vector<Hitch>& FrameStats::getHitches() const {
+	return hitches;
+}
+
+// hitches
+void FrameStats::detectHitch(double frameTime) {
+	if (frames < HITCH_WARMUP_FRAMES) {
+		return;
+	}
+
+	double medianTime = getPercentile(50.0);
+	if (frameTime < HITCH_MIN_TIME || frameTime < medianTime * HITCH_FACTOR) {
+		return;
+	}
+
+	Hitch hitch;
+	hitch.frame = frames;
+	hitch.frameTime = frameTime;
+	hitch.medianTime = medianTime;
+
+	// zones of the frame which was just profiled, by self time, so parents don't hide their children
+	const std::unordered_map<std::string, ZoneStats>& zones = Profiler::getLastFrame();
+	for (auto it = zones.begin(); it != zones.end(); it++) {
+		hitch.zones.push_back({ it->first, it->second.selfTime / NANOSECONDS_PER_MILISECOND });
+	}
+
+	std::sort(hitch.zones.begin(), hitch.zones.end(), [](const HitchZone& a, const HitchZone& b) {
+		return a.time > b.time;
+	});
+	if (hitch.zones.size() > HITCH_ZONES) {
+		hitch.zones.resize(HITCH_ZONES);
+	}
+
+	// only the newest hitches are kept, count covers all of them
+	if (hitches.size() == MAX_HITCHES) {
+		hitches.erase(hitches.begin());
+	}
+	hitches.push_back(hitch);
+	hitchCount++;
+
+	if (logging) {
+		logHitch(hitch);
+	}
+}
+
+void FrameStats::logHitch(const Hitch& hitch) {
+	std::streamsize precision = std::cout.precision();
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "Hitch in frame " << hitch.frame << ": " << hitch.frameTime << " ms, median " << hitch.medianTime << " ms" << std::endl;
+
+	for (size_t i = 0; i < hitch.zones.size(); i++) {
+		std::cout << "  " << hitch.zones[i].name << ": " << hitch.zones[i].time << " ms" << std::endl;
+	}
+	std::cout.unsetf(std::ios::floatfield);
+	std::cout.precision(precision);
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <string>
+#include <vector>
+
+// histogram covers 0 - 100 ms in 0.1 ms buckets, longer frames go to the last bucket
+#define FRAME_STATS_BUCKETS 1000
+#define FRAME_STATS_BUCKET_WIDTH 0.1
+// frame is a hitch when it takes HITCH_FACTOR times the median and at least HITCH_MIN_TIME
+#define HITCH_FACTOR 2.0
+#define HITCH_MIN_TIME 8.0
+// frames measured before hitches are detected, median is not stable before
+#define HITCH_WARMUP_FRAMES 60
+#define MAX_HITCHES 64
+#define HITCH_ZONES 5
+#define FRAME_STATS_PRINT_INTERVAL 600
+
+// profiler zone which took the most time in a hitch, self time in miliseconds
+struct HitchZone {
+	std::string name;
+	double time;
+};
+
+struct Hitch {
+	int frame;
+	double frameTime;
+	double medianTime;
+	std::vector<HitchZone> zones;
+};
+
+// Frame times measured with the profiler clock. Times are kept in a histogram for percentiles,
+// frames much longer than the median are logged as hitches together with the zones of the
+// last profiled frame. Times are in miliseconds.
+class FrameStats
+{
+private:
+	int buckets[FRAME_STATS_BUCKETS];
+	std::vector<Hitch> hitches;
+	long long previousTime;
+	long long totalTime;
+	double maxTime;
+	double lastTime;
+	int frames;
+	int hitchCount;
+	int printMarker;
+	bool logging;
+public:
+	// constructors
+	FrameStats();
+
+	// update
+	void update();
+	void addFrame(double frameTime);
+	void reset();
+
+	// print
+	void printSummary();
+
+	// setters
+	void setLogging(bool logging);
+
+	// getters
+	double getPercentile(double percentile) const;
+	double getAverage() const;
+	double getMax() const;
+	double getLastTime() const;
+	int getFrameCount() const;
+	int getHitchCount() const;
+	const std::vector<Hitch>& getHitches() const;
+private:
+	// hitches
+	void detectHitch(double frameTime);
+	void logHitch(const Hitch& hitch);
+};
@@ -1,30 +1,26 @@
 #include "GLSL_Light.h"
 
-GLSL_Light::GLSL_Light(float x, float y, float width, float height, const Color& color, int& offset, std::vector<Vertex>& lightVertices) : GLSL_Object(GL_TRIANGLES, 6, offset) {
-	init(x, y, width, height, color, offset, lightVertices);
+GLSL_Light::GLSL_Light(float x, float y, float width, float height, const Color& color, VertexStream& vertexBuffer) : GLSL_Object(GL_TRIANGLES, 4, 6, vertexBuffer.getSize()) {
+	init(x, y, width, height, color, vertexBuffer);
 }
 
-void GLSL_Light::init(float x, float y, float width, float height, const Color& color, int& offset, std::vector<Vertex>& lightVertices) {
-	generateVertices(x, y, width, height, color, lightVertices);
-	updateOffset(offset);
+void GLSL_Light::init(float x, float y, float width, float height, const Color& color, VertexStream& vertexBuffer) {
+	generateVertices(x, y, width, height, color, vertexBuffer);
 }
 
-void GLSL_Light::generateVertices(float x, float y, float width, float height, const Color& color, std::vector<Vertex>& lightVertices) {
+void GLSL_Light::generateVertices(float x, float y, float width, float height, const Color& color, VertexStream& vertexBuffer) {
+	// corners are shared by both triangles, see QuadIndexBuffer
+	Vertex* vertices = (Vertex*)vertexBuffer.allocate(4);
+
 	// top-right corner
-	lightVertices.emplace_back(x + width, y + height, 1.0f, 1.0f, color);
+	vertices[0] = Vertex(x + width, y + height, 1.0f, 1.0f, color);
 
 	// top-left corner
-	lightVertices.emplace_back(x, y + height, -1.0f, 1.0f, color);
+	vertices[1] = Vertex(x, y + height, -1.0f, 1.0f, color);
 
 	// bottom-left corner
-	lightVertices.emplace_back(x, y, -1.0f, -1.0f, color);
-
-	// top-right corner
-	lightVertices.emplace_back(x + width, y + height, 1.0f, 1.0f, color);
+	vertices[2] = Vertex(x, y, -1.0f, -1.0f, color);
 
 	// bottom-right corner
-	lightVertices.emplace_back(x + width, y, 1.0f, -1.0f, color);
-
-	// bottom-left corner
-	lightVertices.emplace_back(x, y, -1.0f, -1.0f, color);
+	vertices[3] = Vertex(x + width, y, 1.0f, -1.0f, color);
 }
@@ -1,13 +1,12 @@
 #pragma once
 #include "GLSL_Object.h"
 #include "Light.h"
-#include <vector>
 class GLSL_Light : public GLSL_Object
 {
 public:
-	GLSL_Light(float x, float y, float width, float height, const Color& color, int& offset, std::vector<Vertex>& lightVertices);
+	GLSL_Light(float x, float y, float width, float height, const Color& color, VertexStream& vertexBuffer);
 private:
-	void init(float x, float y, float width, float height, const Color& color, int& offset, std::vector<Vertex>& lightVertices);
-	void generateVertices(float x, float y, float width, float height, const Color& color, std::vector<Vertex>& lightVertices);
+	void init(float x, float y, float width, float height, const Color& color, VertexStream& vertexBuffer);
+	void generateVertices(float x, float y, float width, float height, const Color& color, VertexStream& vertexBuffer);
 };
 
@@ -1,12 +1,21 @@
 #include "GLSL_Object.h"
 #include <cstddef>
 
-GLSL_Object::GLSL_Object(GLenum mode, int vertexNumber, int offset) : mode(mode), vertexNumber(vertexNumber), offset(offset) {
+GLSL_Object::GLSL_Object() : mode(GL_TRIANGLES), vertexNumber(0), indexNumber(0), instanceNumber(0), offset(0) {
 
 }
 
-void GLSL_Object::updateOffset(int& offset) {
-	offset += vertexNumber;
+GLSL_Object::GLSL_Object(GLenum mode, int vertexNumber, int offset) : mode(mode), vertexNumber(vertexNumber), indexNumber(0), instanceNumber(0), offset(offset) {
+
+}
+
+GLSL_Object::GLSL_Object(GLenum mode, int vertexNumber, int indexNumber, int offset) : mode(mode), vertexNumber(vertexNumber), indexNumber(indexNumber), instanceNumber(0), offset(offset) {
+
+}
+
+// setters
+void GLSL_Object::setInstanceNumber(int instanceNumber) {
+	this->instanceNumber = instanceNumber;
 }
 
 // getters
@@ -18,11 +27,67 @@ int GLSL_Object::getVertexNumber() const {
 	return vertexNumber;
 }
 
+int GLSL_Object::getIndexNumber() const {
+	return indexNumber;
+}
+
+int GLSL_Object::getInstanceNumber() const {
+	return instanceNumber;
+}
+
 GLenum GLSL_Object::getMode() const {
 	return mode;
 }
 
+bool GLSL_Object::isIndexed() const {
+	return indexNumber > 0;
+}
+
+bool GLSL_Object::isInstanced() const {
+	return instanceNumber > 0;
+}
+
+// batching
+bool GLSL_Object::merge(const GLSL_Object& object) {
+	if (mode != object.mode || isIndexed() != object.isIndexed() || isInstanced() != object.isInstanced()) {
+		return false;
+	}
+
+	if (isInstanced()) {
+		// instances of the same shape which follow each other in the instance buffer
+		if (vertexNumber != object.vertexNumber || offset + instanceNumber != object.offset) {
+			return false;
+		}
+		instanceNumber = instanceNumber + object.instanceNumber;
+		return true;
+	}
 
+	if (offset + vertexNumber != object.offset) {
+		return false;
+	}
 
+	if (isIndexed()) {
+		// indexed objects are quads, QuadIndexBuffer continues with the next quad's indices
+		vertexNumber = vertexNumber + object.vertexNumber;
+		indexNumber = indexNumber + object.indexNumber;
+		return true;
+	}
 
+	// strips and fans can't be joined without breaking the primitive
+	if (!isListPrimitive()) {
+		return false;
+	}
 
+	vertexNumber = vertexNumber + object.vertexNumber;
+	return true;
+}
+
+void GLSL_Object::relocate(int baseOffset) {
+	// vertices recorded in another stream were copied behind baseOffset vertices
+	offset = offset + baseOffset;
+}
+
+// helper
+bool GLSL_Object::isListPrimitive() const {
+	return mode == GL_POINTS || mode == GL_LINES || mode == GL_TRIANGLES;
+}
@@ -1,23 +1,41 @@
 #pragma once
 #include <GL/glew.h>
 #include "Vertex.h"
+#include "VertexStream.h"
 
 class GLSL_Object
 {
 private:
 	GLenum mode;
 	int vertexNumber;
+	int indexNumber;
+	int instanceNumber;
 	int offset;
+public:
+	// empty object, draws nothing
+	GLSL_Object();
 protected:
 	// constructors
 	GLSL_Object(GLenum mode, int vertexNumber, int offset);
+	GLSL_Object(GLenum mode, int vertexNumber, int indexNumber, int offset);
 
 	// setters
-	void updateOffset(int& offset);
+	void setInstanceNumber(int instanceNumber);
 public:
 	// getters
 	int getOffset() const;
 	int getVertexNumber() const;
+	int getIndexNumber() const;
+	int getInstanceNumber() const;
 	GLenum getMode() const;
+	bool isIndexed() const;
+	bool isInstanced() const;
+
+	// batching
+	bool merge(const GLSL_Object& object);
+	void relocate(int baseOffset);
+private:
+	// helper
+	bool isListPrimitive() const;
 };
 
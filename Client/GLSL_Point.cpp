@@ -1,16 +1,17 @@
 #include "GLSL_Point.h"
 
-GLSL_Point::GLSL_Point(const glm::vec2& p, const Color& color, int& offset, std::vector<Vertex>& vertices) : GLSL_Object(GL_POINTS, 1, offset) {
-	init(p, color, offset, vertices);
+GLSL_Point::GLSL_Point(const glm::vec2& p, const Color& color, VertexStream& vertexBuffer) : GLSL_Object(GL_POINTS, 1, vertexBuffer.getSize()) {
+	init(p, color, vertexBuffer);
 }
 
-void GLSL_Point::init(const glm::vec2& p, const Color& color, int& offset, std::vector<Vertex>& vertices) {
-	generateVertecies(p, color, vertices);
-	updateOffset(offset);
+void GLSL_Point::init(const glm::vec2& p, const Color& color, VertexStream& vertexBuffer) {
+	generateVertecies(p, color, vertexBuffer);
 }
 
-void GLSL_Point::generateVertecies(const glm::vec2& p, const Color& color, std::vector<Vertex>& vertices) {
+void GLSL_Point::generateVertecies(const glm::vec2& p, const Color& color, VertexStream& vertexBuffer) {
+	ColorVertex* vertices = (ColorVertex*)vertexBuffer.allocate(1);
+
 	// one point
-	vertices.emplace_back(p.x, p.y, color);
+	vertices[0] = ColorVertex(p.x, p.y, color);
 }
 
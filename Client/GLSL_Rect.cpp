@@ -0,0 +1,20 @@
+#include "GLSL_Rect.h"
+
+GLSL_Rect::GLSL_Rect(float x, float y, float width, float height, Color color, VertexStream& instanceBuffer) : GLSL_Texture(GL_TRIANGLE_STRIP, 4, instanceBuffer.getSize(), 0) {
+	init(x, y, width, height, glm::vec4(0.0f, 0.0f, 1.0f, 1.0f), color, 0, instanceBuffer);
+}
+
+GLSL_Rect::GLSL_Rect(float x, float y, float width, float height, const glm::vec4& uv, const GLTexture& texture, VertexStream& instanceBuffer) : GLSL_Texture(GL_TRIANGLE_STRIP, 4, instanceBuffer.getSize(), texture.arrayID) {
+	init(x, y, width, height, uv, WHITE, texture.layer, instanceBuffer);
+}
+
+void GLSL_Rect::init(float x, float y, float width, float height, const glm::vec4& uv, Color color, int layer, VertexStream& instanceBuffer) {
+	setInstanceNumber(1);
+	generateInstance(x, y, width, height, uv, color, layer, instanceBuffer);
+}
+
+void GLSL_Rect::generateInstance(float x, float y, float width, float height, const glm::vec4& uv, Color color, int layer, VertexStream& instanceBuffer) {
+	// four corners are generated from gl_VertexID in instanceShader.vert
+	RectInstance* instance = (RectInstance*)instanceBuffer.allocate(1);
+	*instance = RectInstance(x, y, width, height, uv, color, layer);
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include "GLSL_Texture.h"
+#include "GLTexture.h"
+#include "RectInstance.h"
+#include <glm/glm.hpp>
+
+// axis aligned rectangle drawn as one instance, offset is the index of its instance record
+// untextured rectangles have texture ID 0, textured ones keep ID of the texture array and their layer
+class GLSL_Rect : public GLSL_Texture
+{
+public:
+	GLSL_Rect(float x, float y, float width, float height, Color color, VertexStream& instanceBuffer);
+	GLSL_Rect(float x, float y, float width, float height, const glm::vec4& uv, const GLTexture& texture, VertexStream& instanceBuffer);
+private:
+	void init(float x, float y, float width, float height, const glm::vec4& uv, Color color, int layer, VertexStream& instanceBuffer);
+	void generateInstance(float x, float y, float width, float height, const glm::vec4& uv, Color color, int layer, VertexStream& instanceBuffer);
+};
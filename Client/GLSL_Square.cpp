@@ -1,31 +1,27 @@
 #include "GLSL_Square.h"
 
-GLSL_Square::GLSL_Square(float x, float y, float width, float height, Color color, int& offset, std::vector<Vertex>& vertices) : GLSL_Object(GL_TRIANGLES, 6, offset) {
-	init(x, y, width, height, color, offset, vertices);
+GLSL_Square::GLSL_Square(float x, float y, float width, float height, Color color, VertexStream& vertexBuffer) : GLSL_Object(GL_TRIANGLES, 4, 6, vertexBuffer.getSize()) {
+	init(x, y, width, height, color, vertexBuffer);
 }
 
-void GLSL_Square::init(float x, float y, float width, float height, Color color, int& offset, std::vector<Vertex>& vertices) {
-	generateVertecies(x, y, width, height, color, vertices);
-	updateOffset(offset);
+void GLSL_Square::init(float x, float y, float width, float height, Color color, VertexStream& vertexBuffer) {
+	generateVertecies(x, y, width, height, color, vertexBuffer);
 }
 
-void GLSL_Square::generateVertecies(float x, float y, float width, float height, Color color, std::vector<Vertex>& vertices) {
+void GLSL_Square::generateVertecies(float x, float y, float width, float height, Color color, VertexStream& vertexBuffer) {
+	// corners are shared by both triangles, see QuadIndexBuffer
+	ColorVertex* vertices = (ColorVertex*)vertexBuffer.allocate(4);
+
 	// top-right corner
-	vertices.emplace_back(x + width, y + height, color);
+	vertices[0] = ColorVertex(x + width, y + height, color);
 	
 	// top-left corner
-	vertices.emplace_back(x, y + height, color);
+	vertices[1] = ColorVertex(x, y + height, color);
 
 	// bottom-left corner
-	vertices.emplace_back(x, y, color);
-
-	// top-right corner
-	vertices.emplace_back(x + width, y + height, color);
+	vertices[2] = ColorVertex(x, y, color);
 
 	// bottom-right corner
-	vertices.emplace_back(x + width, y, color);
-
-	// bottom-left corner
-	vertices.emplace_back(x, y, color);
+	vertices[3] = ColorVertex(x + width, y, color);
 }
 
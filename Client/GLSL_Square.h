@@ -1,13 +1,12 @@
 #pragma once
 #include "GLSL_Object.h"
-#include <vector>
 
 class GLSL_Square : public GLSL_Object
 {
 public:
-	GLSL_Square(float x, float y, float width, float height, Color color, int& offset, std::vector<Vertex>& vertices);
+	GLSL_Square(float x, float y, float width, float height, Color color, VertexStream& vertexBuffer);
 private:
-	void init(float x, float y, float width, float height, Color color, int& offset, std::vector<Vertex>& vertices);
-	void generateVertecies(float x, float y, float width, float height, Color color, std::vector<Vertex>& vertices);
+	void init(float x, float y, float width, float height, Color color, VertexStream& vertexBuffer);
+	void generateVertecies(float x, float y, float width, float height, Color color, VertexStream& vertexBuffer);
 };
 
@@ -1,35 +1,42 @@
 #include "GLSL_Texture.h"
 
-GLSL_Texture::GLSL_Texture(float x, float y, float width, float height, const glm::vec4& uv, const GLTexture& texture, int& offset, std::vector<Vertex>& textureVertices) : GLSL_Object(GL_TRIANGLES, 6, offset), textureID(texture.ID) {
-	init(x, y, width, height, uv, offset, textureVertices);
+GLSL_Texture::GLSL_Texture(float x, float y, float width, float height, const glm::vec4& uv, const GLTexture& texture, VertexStream& vertexBuffer) : GLSL_Object(GL_TRIANGLES, 4, 6, vertexBuffer.getSize()), textureID(texture.ID) {
+	init(x, y, width, height, uv, vertexBuffer);
 }
 
-void GLSL_Texture::init(float x, float y, float width, float height, const glm::vec4& uv, int& offset, std::vector<Vertex>& textureVertices) {
-	generateVertices(x, y, width, height, uv, textureVertices);
-	updateOffset(offset);
+GLSL_Texture::GLSL_Texture(GLenum mode, int vertexNumber, int offset, GLuint textureID) : GLSL_Object(mode, vertexNumber, offset), textureID(textureID) {
+
+}
+
+void GLSL_Texture::init(float x, float y, float width, float height, const glm::vec4& uv, VertexStream& vertexBuffer) {
+	generateVertices(x, y, width, height, uv, vertexBuffer);
 }
 
-void GLSL_Texture::generateVertices(float x, float y, float width, float height, const glm::vec4& uv, std::vector<Vertex>& textureVertices) {
+void GLSL_Texture::generateVertices(float x, float y, float width, float height, const glm::vec4& uv, VertexStream& vertexBuffer) {
+	// corners are shared by both triangles, see QuadIndexBuffer
+	Vertex* vertices = (Vertex*)vertexBuffer.allocate(4);
+
 	// top-right corner
-	textureVertices.emplace_back(x + width, y + height, uv.x + uv.z, uv.y + uv.w, WHITE);
+	vertices[0] = Vertex(x + width, y + height, uv.x + uv.z, uv.y + uv.w, WHITE);
 
 	// top-left corner
-	textureVertices.emplace_back(x, y + height, uv.x, uv.y + uv.w, WHITE);
+	vertices[1] = Vertex(x, y + height, uv.x, uv.y + uv.w, WHITE);
 
 	// bottom-left corner
-	textureVertices.emplace_back(x, y, uv.x, uv.y, WHITE);
-
-	// top-right corner
-	textureVertices.emplace_back(x + width, y + height, uv.x + uv.z, uv.y + uv.w, WHITE);
+	vertices[2] = Vertex(x, y, uv.x, uv.y, WHITE);
 
 	// bottom-right corner
-	textureVertices.emplace_back(x + width, y, uv.x + uv.z, uv.y, WHITE);
-
-	// bottom-left corner
-	textureVertices.emplace_back(x, y, uv.x, uv.y, WHITE);
+	vertices[3] = Vertex(x + width, y, uv.x + uv.z, uv.y, WHITE);
 }
 
 GLuint GLSL_Texture::getTextureID() const {
 	return textureID;
 }
 
+// batching
+bool GLSL_Texture::merge(const GLSL_Texture& texture) {
+	if (textureID != texture.textureID) {
+		return false;
+	}
+	return GLSL_Object::merge(texture);
+}
@@ -4,16 +4,20 @@
 #include "Square.h"
 #include <GL/glew.h>
 #include <glm/glm.hpp>
-#include <vector>
 class GLSL_Texture : public GLSL_Object
 {
 private:
 	GLuint textureID;
 public:
-	GLSL_Texture(float x, float y, float width, float height, const glm::vec4& uv, const GLTexture& texture, int& offset, std::vector<Vertex>& textureVertices);
+	GLSL_Texture(float x, float y, float width, float height, const glm::vec4& uv, const GLTexture& texture, VertexStream& vertexBuffer);
 	GLuint getTextureID() const;
+
+	// batching
+	bool merge(const GLSL_Texture& texture);
+protected:
+	GLSL_Texture(GLenum mode, int vertexNumber, int offset, GLuint textureID);
 private:
-	void init(float x, float y, float width, float height, const glm::vec4& uv, int& offset, std::vector<Vertex>& textureVertices);
-	void generateVertices(float x, float y, float width, float height, const glm::vec4& uv, std::vector<Vertex>& textureVertices);
+	void init(float x, float y, float width, float height, const glm::vec4& uv, VertexStream& vertexBuffer);
+	void generateVertices(float x, float y, float width, float height, const glm::vec4& uv, VertexStream& vertexBuffer);
 };
 
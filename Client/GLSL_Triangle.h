@@ -1,13 +1,12 @@
 #pragma once
 #include "GLSL_Object.h"
-#include <vector>
 #include <glm/glm.hpp>
 class GLSL_Triangle : public GLSL_Object
 {
 public:
-	GLSL_Triangle(const glm::vec2& p1, const glm::vec2& p2, const glm::vec2& p3, const Color& color, int& offset, std::vector<Vertex>& vertices);
+	GLSL_Triangle(const glm::vec2& p1, const glm::vec2& p2, const glm::vec2& p3, const Color& color, VertexStream& vertexBuffer);
 private:
-	void init(const glm::vec2& p1, const glm::vec2& p2, const glm::vec2& p3, const Color& color, int& offset, std::vector<Vertex>& vertices);
-	void generateVertices(const glm::vec2& p1, const glm::vec2& p2, const glm::vec2& p3, const Color& color, std::vector<Vertex>& vertices);
+	void init(const glm::vec2& p1, const glm::vec2& p2, const glm::vec2& p3, const Color& color, VertexStream& vertexBuffer);
+	void generateVertices(const glm::vec2& p1, const glm::vec2& p2, const glm::vec2& p3, const Color& color, VertexStream& vertexBuffer);
 };
 
@@ -0,0 +1,200 @@
+#include "GLState.h"
+#include "GraphicsBackend.h"
+
+// default GL state, blend factors are GL_ONE, GL_ZERO for both color and alpha
+GLuint GLState::program = 0;
+GLuint GLState::vertexArray = 0;
+GLuint GLState::arrayBuffer = 0;
+GLuint GLState::uniformBuffer = 0;
+GLenum GLState::textureUnit = GL_TEXTURE0;
+GLuint GLState::textures[MAX_TEXTURE_UNITS] = {};
+GLuint GLState::textureArrays[MAX_TEXTURE_UNITS] = {};
+GLenum GLState::blendFactors[4] = { GL_ONE, GL_ZERO, GL_ONE, GL_ZERO };
+
+int GLState::issuedCalls = 0;
+int GLState::skippedCalls = 0;
+
+// bind
+void GLState::useProgram(GLuint programID) {
+	if (skip(program == programID)) {
+		return;
+	}
+	program = programID;
+	GraphicsBackend::get().useProgram(programID);
+}
+
+void GLState::bindVertexArray(GLuint vertexArrayID) {
+	if (skip(vertexArray == vertexArrayID)) {
+		return;
+	}
+	vertexArray = vertexArrayID;
+	GraphicsBackend::get().bindVertexArray(vertexArrayID);
+}
+
+void GLState::bindBuffer(GLenum target, GLuint bufferID) {
+	// element array buffer belongs to the bound vertex array, so only global bindings are tracked
+	switch (target) {
+	case GL_ARRAY_BUFFER: {
+		if (skip(arrayBuffer == bufferID)) {
+			return;
+		}
+		arrayBuffer = bufferID;
+		break;
+	}
+	case GL_UNIFORM_BUFFER: {
+		if (skip(uniformBuffer == bufferID)) {
+			return;
+		}
+		uniformBuffer = bufferID;
+		break;
+	}
+	default:
+		skip(false);
+		break;
+	}
+	GraphicsBackend::get().bindBuffer(target, bufferID);
+}
+
+void GLState::activeTexture(GLenum unit) {
+	if (skip(textureUnit == unit)) {
+		return;
+	}
+	textureUnit = unit;
+	GraphicsBackend::get().activeTexture(unit);
+}
+
+void GLState::bindTexture(GLenum target, GLuint textureID) {
+	// 2D textures and texture arrays are tracked, other targets are always issued
+	GLuint* texture = getTextureBinding(target);
+
+	if (texture == nullptr) {
+		skip(false);
+	}
+	else if (skip(*texture == textureID)) {
+		return;
+	}
+	else {
+		*texture = textureID;
+	}
+	GraphicsBackend::get().bindTexture(target, textureID);
+}
+
+// blend
+void GLState::blendFunc(GLenum sourceFactor, GLenum destinationFactor) {
+	blendFuncSeparate(sourceFactor, destinationFactor, sourceFactor, destinationFactor);
+}
+
+void GLState::blendFuncSeparate(GLenum sourceRGB, GLenum destinationRGB, GLenum sourceAlpha, GLenum destinationAlpha) {
+	bool redundant = blendFactors[0] == sourceRGB && blendFactors[1] == destinationRGB && blendFactors[2] == sourceAlpha && blendFactors[3] == destinationAlpha;
+
+	if (skip(redundant)) {
+		return;
+	}
+
+	blendFactors[0] = sourceRGB;
+	blendFactors[1] = destinationRGB;
+	blendFactors[2] = sourceAlpha;
+	blendFactors[3] = destinationAlpha;
+
+	GraphicsBackend::get().blendFuncSeparate(sourceRGB, destinationRGB, sourceAlpha, destinationAlpha);
+}
+
+// delete
+void GLState::deleteBuffer(GLuint bufferID) {
+	// deleted names can be generated again, so they must not stay cached
+	if (arrayBuffer == bufferID) {
+		arrayBuffer = 0;
+	}
+	if (uniformBuffer == bufferID) {
+		uniformBuffer = 0;
+	}
+	GraphicsBackend::get().deleteBuffers(1, &bufferID);
+}
+
+void GLState::deleteVertexArray(GLuint vertexArrayID) {
+	if (vertexArray == vertexArrayID) {
+		vertexArray = 0;
+	}
+	GraphicsBackend::get().deleteVertexArrays(1, &vertexArrayID);
+}
+
+void GLState::deleteTexture(GLuint textureID) {
+	for (int i = 0; i < MAX_TEXTURE_UNITS; i++) {
+		if (textures[i] == textureID) {
+			textures[i] = 0;
+		}
+		if (textureArrays[i] == textureID) {
+			textureArrays[i] = 0;
+		}
+	}
+	GraphicsBackend::get().deleteTextures(1, &textureID);
+}
+
+// reset
+void GLState::invalidate() {
+	// must be called when GL state was changed without GLState, next call of every kind is issued
+	program = GL_STATE_UNKNOWN;
+	vertexArray = GL_STATE_UNKNOWN;
+	arrayBuffer = GL_STATE_UNKNOWN;
+	uniformBuffer = GL_STATE_UNKNOWN;
+
+	for (int i = 0; i < MAX_TEXTURE_UNITS; i++) {
+		textures[i] = GL_STATE_UNKNOWN;
+		textureArrays[i] = GL_STATE_UNKNOWN;
+	}
+
+	for (int i = 0; i < 4; i++) {
+		blendFactors[i] = GL_STATE_UNKNOWN;
+	}
+
+	// texture unit is needed to index textures, so it is reset instead
+	textureUnit = GL_TEXTURE0;
+	GraphicsBackend::get().activeTexture(GL_TEXTURE0);
+}
+
+void GLState::resetStatistics() {
+	issuedCalls = 0;
+	skippedCalls = 0;
+}
+
+// getters
+GLuint GLState::getTexture(GLenum target) {
+	GLuint* texture = getTextureBinding(target);
+
+	if (texture == nullptr) {
+		return GL_STATE_UNKNOWN;
+	}
+	return *texture;
+}
+
+int GLState::getIssuedCalls() {
+	return issuedCalls;
+}
+
+int GLState::getSkippedCalls() {
+	return skippedCalls;
+}
+
+// helper
+bool GLState::skip(bool redundant) {
+	if (redundant) {
+		skippedCalls++;
+	}
+	else {
+		issuedCalls++;
+	}
+	return redundant;
+}
+
+GLuint* GLState::getTextureBinding(GLenum target) {
+	int unit = textureUnit - GL_TEXTURE0;
+
+	switch (target) {
+	case GL_TEXTURE_2D:
+		return &textures[unit];
+	case GL_TEXTURE_2D_ARRAY:
+		return &textureArrays[unit];
+	default:
+		return nullptr;
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <GL/glew.h>
+
+#define MAX_TEXTURE_UNITS 16
+#define GL_STATE_UNKNOWN 0xFFFFFFFF
+
+// Thin tracker of bound GL objects and blend state. Every engine bind goes through it,
+// calls which would not change the current state are skipped and counted.
+class GLState
+{
+private:
+	static GLuint program;
+	static GLuint vertexArray;
+	static GLuint arrayBuffer;
+	static GLuint uniformBuffer;
+	static GLenum textureUnit;
+	static GLuint textures[MAX_TEXTURE_UNITS];
+	static GLuint textureArrays[MAX_TEXTURE_UNITS];
+	static GLenum blendFactors[4];
+
+	static int issuedCalls;
+	static int skippedCalls;
+public:
+	// bind
+	static void useProgram(GLuint programID);
+	static void bindVertexArray(GLuint vertexArrayID);
+	static void bindBuffer(GLenum target, GLuint bufferID);
+	static void activeTexture(GLenum unit);
+	static void bindTexture(GLenum target, GLuint textureID);
+
+	// blend
+	static void blendFunc(GLenum sourceFactor, GLenum destinationFactor);
+	static void blendFuncSeparate(GLenum sourceRGB, GLenum destinationRGB, GLenum sourceAlpha, GLenum destinationAlpha);
+
+	// delete
+	static void deleteBuffer(GLuint bufferID);
+	static void deleteVertexArray(GLuint vertexArrayID);
+	static void deleteTexture(GLuint textureID);
+
+	// reset
+	static void invalidate();
+	static void resetStatistics();
+
+	// getters
+	static GLuint getTexture(GLenum target = GL_TEXTURE_2D);
+	static int getIssuedCalls();
+	static int getSkippedCalls();
+private:
+	// helper
+	static bool skip(bool redundant);
+	static GLuint* getTextureBinding(GLenum target);
+};
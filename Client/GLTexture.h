@@ -1,8 +1,11 @@
 #pragma once
 #include <GL/glew.h>
 
+// arrayID and layer locate the same image inside a texture array, arrayID is 0 if it is not in one
 struct GLTexture {
 	GLuint ID;
 	int width;
 	int height;
+	GLuint arrayID;
+	int layer;
 };
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "GPUTimer.h"
+#include "GraphicsBackend.h"
+#include <glm/glm.hpp>
+
+GPUTimer::GPUTimer() : queries(), names(), starts(), zoneNumbers(), track(nullptr), frame(0), droppedFrames(0), supported(false), open(false) {
+
+}
+
+// init
+void GPUTimer::init() {
+	if (check()) {
+		// core since 3.3, software drivers such as llvmpipe have it as well
+		supported = GLEW_VERSION_3_3 || GLEW_ARB_timer_query;
+		if (!supported) {
+			return;
+		}
+
+		for (int i = 0; i < GPU_TIMER_FRAMES; i++) {
+			GraphicsBackend::get().genQueries(MAX_GPU_ZONES, queries[i]);
+		}
+
+		track = Profiler::createTrack("GPU", "gpu");
+	}
+}
+
+// begin / end
+void GPUTimer::beginFrame() {
+	if (!supported) {
+		return;
+	}
+
+	end();
+
+	// queries of the oldest frame are reused, their results are read first
+	frame = (frame + 1) % GPU_TIMER_FRAMES;
+	readResults(frame);
+	zoneNumbers[frame] = 0;
+}
+
+void GPUTimer::begin(const char* name) {
+	if (!supported || zoneNumbers[frame] == MAX_GPU_ZONES) {
+		return;
+	}
+
+	end();
+
+	int zone = zoneNumbers[frame]++;
+	names[frame][zone] = name;
+	starts[frame][zone] = Profiler::now();
+
+	GraphicsBackend::get().beginQuery(GL_TIME_ELAPSED, queries[frame][zone]);
+	open = true;
+}
+
+void GPUTimer::end() {
+	if (open) {
+		GraphicsBackend::get().endQuery(GL_TIME_ELAPSED);
+		open = false;
+	}
+}
+
+// read
+void GPUTimer::readResults(int frame) {
+	int zoneNumber = zoneNumbers[frame];
+	if (zoneNumber == 0) {
+		return;
+	}
+
+	// queries finish in order, when the last one is not ready the frame is dropped instead of waiting
+	GLint available = 0;
+	GraphicsBackend::get().getQueryObjectiv(queries[frame][zoneNumber - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+	if (available == 0) {
+		droppedFrames++;
+		return;
+	}
+
+	// GPU runs behind CPU, a zone can't start before the previous one ended
+	long long end = 0;
+	for (int i = 0; i < zoneNumber; i++) {
+		GLuint64 time = 0;
+		GraphicsBackend::get().getQueryObjectui64v(queries[frame][i], GL_QUERY_RESULT, &time);
+
+		long long start = glm::max(starts[frame][i], end);
+		end = start + (long long)time;
+		Profiler::addRecord(track, names[frame][i], start, end, 0);
+	}
+}
+
+// getters
+int GPUTimer::getDroppedFrames() const {
+	return droppedFrames;
+}
+
+bool GPUTimer::isSupported() const {
+	return supported;
+}
+
+// helper
+bool GPUTimer::check() {
+	return track == nullptr;
+}
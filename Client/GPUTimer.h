@@ -0,0 +1,46 @@
+#pragma once
+#include "Profiler.h"
+#include <GL/glew.h>
+
+// frames a query is in flight before its result is read, reading earlier would stall on GPU
+#define GPU_TIMER_FRAMES 4
+#define MAX_GPU_ZONES 16
+
+// GPU time of consecutive zones measured with GL_TIME_ELAPSED queries. Every frame has its own
+// set of queries, results are read GPU_TIMER_FRAMES later and added to the "GPU" profiler track,
+// placed where their zones were issued on CPU. Time elapsed queries can't be nested, so a zone
+// ends when the next one begins.
+class GPUTimer
+{
+private:
+	GLuint queries[GPU_TIMER_FRAMES][MAX_GPU_ZONES];
+	const char* names[GPU_TIMER_FRAMES][MAX_GPU_ZONES];
+	long long starts[GPU_TIMER_FRAMES][MAX_GPU_ZONES];
+	int zoneNumbers[GPU_TIMER_FRAMES];
+	ProfileThread* track;
+	int frame;
+	int droppedFrames;
+	bool supported;
+	bool open;
+public:
+	// constructors
+	GPUTimer();
+
+	// init
+	void init();
+
+	// begin / end
+	void beginFrame();
+	void begin(const char* name);
+	void end();
+
+	// getters
+	int getDroppedFrames() const;
+	bool isSupported() const;
+private:
+	// read
+	void readResults(int frame);
+
+	// helper
+	bool check();
+};
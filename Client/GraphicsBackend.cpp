@@ -0,0 +1,20 @@
+#include "GraphicsBackend.h"
+#include "OpenGLBackend.h"
+
+static OpenGLBackend openGLBackend;
+
+GraphicsBackend* GraphicsBackend::backend = &openGLBackend;
+
+GraphicsBackend::~GraphicsBackend() {
+
+}
+
+// current backend
+GraphicsBackend& GraphicsBackend::get() {
+	return *backend;
+}
+
+void GraphicsBackend::set(GraphicsBackend* backend) {
+	// nullptr goes back to OpenGL, must be called before any GL object is created
+	GraphicsBackend::backend = backend != nullptr ? backend : &openGLBackend;
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include <GL/glew.h>
+
+// Every GL call of the engine goes through the current backend, OpenGLBackend by default.
+// Methods are named after the GL functions they replace and take the same arguments.
+class GraphicsBackend
+{
+private:
+	static GraphicsBackend* backend;
+public:
+	virtual ~GraphicsBackend();
+
+	// current backend
+	static GraphicsBackend& get();
+	static void set(GraphicsBackend* backend);
+
+	// buffers
+	virtual void genBuffers(GLsizei n, GLuint* buffers) = 0;
+	virtual void deleteBuffers(GLsizei n, const GLuint* buffers) = 0;
+	virtual void bindBuffer(GLenum target, GLuint buffer) = 0;
+	virtual void bindBufferBase(GLenum target, GLuint index, GLuint buffer) = 0;
+	virtual void bufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) = 0;
+	virtual void bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) = 0;
+	virtual void bufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags) = 0;
+	virtual void* mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) = 0;
+	virtual GLboolean unmapBuffer(GLenum target) = 0;
+	virtual void copyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) = 0;
+
+	// vertex arrays
+	virtual void genVertexArrays(GLsizei n, GLuint* arrays) = 0;
+	virtual void deleteVertexArrays(GLsizei n, const GLuint* arrays) = 0;
+	virtual void bindVertexArray(GLuint array) = 0;
+	virtual void enableVertexAttribArray(GLuint index) = 0;
+	virtual void vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer) = 0;
+	virtual void vertexAttribDivisor(GLuint index, GLuint divisor) = 0;
+
+	// textures
+	virtual void genTextures(GLsizei n, GLuint* textures) = 0;
+	virtual void deleteTextures(GLsizei n, const GLuint* textures) = 0;
+	virtual void activeTexture(GLenum texture) = 0;
+	virtual void bindTexture(GLenum target, GLuint texture) = 0;
+	virtual void texImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels) = 0;
+	virtual void texImage3D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels) = 0;
+	virtual void texSubImage3D(GLenum target, GLint level, GLint xOffset, GLint yOffset, GLint zOffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels) = 0;
+	virtual void texParameteri(GLenum target, GLenum name, GLint param) = 0;
+	virtual void textureParameteri(GLuint texture, GLenum name, GLint param) = 0;
+	virtual void generateMipmap(GLenum target) = 0;
+
+	// framebuffers
+	virtual void genFramebuffers(GLsizei n, GLuint* framebuffers) = 0;
+	virtual void deleteFramebuffers(GLsizei n, const GLuint* framebuffers) = 0;
+	virtual void bindFramebuffer(GLenum target, GLuint framebuffer) = 0;
+	virtual void framebufferTexture2D(GLenum target, GLenum attachment, GLenum textureTarget, GLuint texture, GLint level) = 0;
+	virtual GLenum checkFramebufferStatus(GLenum target) = 0;
+
+	// shaders
+	virtual GLuint createShader(GLenum type) = 0;
+	virtual void shaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length) = 0;
+	virtual void compileShader(GLuint shader) = 0;
+	virtual void getShaderiv(GLuint shader, GLenum name, GLint* params) = 0;
+	virtual void getShaderInfoLog(GLuint shader, GLsizei bufferSize, GLsizei* length, GLchar* infoLog) = 0;
+	virtual void deleteShader(GLuint shader) = 0;
+	virtual GLuint createProgram() = 0;
+	virtual void attachShader(GLuint program, GLuint shader) = 0;
+	virtual void detachShader(GLuint program, GLuint shader) = 0;
+	virtual void linkProgram(GLuint program) = 0;
+	virtual void getProgramiv(GLuint program, GLenum name, GLint* params) = 0;
+	virtual void bindAttribLocation(GLuint program, GLuint index, const GLchar* name) = 0;
+	virtual void getActiveUniform(GLuint program, GLuint index, GLsizei bufferSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name) = 0;
+	virtual GLint getUniformLocation(GLuint program, const GLchar* name) = 0;
+	virtual GLuint getUniformBlockIndex(GLuint program, const GLchar* name) = 0;
+	virtual void uniformBlockBinding(GLuint program, GLuint blockIndex, GLuint binding) = 0;
+	virtual void useProgram(GLuint program) = 0;
+
+	// uniforms
+	virtual void uniform1i(GLint location, GLint value) = 0;
+	virtual void uniform1f(GLint location, GLfloat value) = 0;
+	virtual void uniform2f(GLint location, GLfloat x, GLfloat y) = 0;
+
+	// draw
+	virtual void drawArrays(GLenum mode, GLint first, GLsizei count) = 0;
+	virtual void drawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint baseVertex) = 0;
+	virtual void multiDrawArrays(GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawCount) = 0;
+	virtual void multiDrawElementsBaseVertex(GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawCount, const GLint* baseVertex) = 0;
+	virtual void drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount) = 0;
+	virtual void drawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount, GLuint baseInstance) = 0;
+
+	// sync
+	virtual GLsync fenceSync(GLenum condition, GLbitfield flags) = 0;
+	virtual GLenum clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) = 0;
+	virtual void deleteSync(GLsync sync) = 0;
+
+	// queries
+	virtual void genQueries(GLsizei n, GLuint* queries) = 0;
+	virtual void deleteQueries(GLsizei n, const GLuint* queries) = 0;
+	virtual void beginQuery(GLenum target, GLuint query) = 0;
+	virtual void endQuery(GLenum target) = 0;
+	virtual void getQueryObjectiv(GLuint query, GLenum name, GLint* params) = 0;
+	virtual void getQueryObjectui64v(GLuint query, GLenum name, GLuint64* params) = 0;
+
+	// frame
+	virtual void blendFuncSeparate(GLenum sourceRGB, GLenum destinationRGB, GLenum sourceAlpha, GLenum destinationAlpha) = 0;
+	virtual void enable(GLenum capability) = 0;
+	virtual void viewport(GLint x, GLint y, GLsizei width, GLsizei height) = 0;
+	virtual void clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) = 0;
+	virtual void clearDepth(GLdouble depth) = 0;
+	virtual void clear(GLbitfield mask) = 0;
+};
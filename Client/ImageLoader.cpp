@@ -1,62 +1,84 @@
 #include "ImageLoader.h"
+#include "GLState.h"
 #include "PicoPNG.H"
 #include "IOManager.h"
 #include "SDLException.h"
+#include "GraphicsBackend.h"
 #include <iostream>
 
 GLTexture ImageLoader::loadTexture(std::string filePath) {
-    // initialize struct components to 0 (use {})
-    GLTexture texture;
-
     // output vector to be filled
     std::vector<unsigned char> out;
-    // input data
-    std::vector<unsigned char> in;
 
     // image props
-    unsigned long width;
-    unsigned long height;
+    int width;
+    int height;
 
-    // read data to input buffer
-    if (IOManager::readFileToBuffer(filePath, in) == false) {
-        throw SDLException("Failed to read PNG file to buffer.");
-    }
+    loadPixels(filePath, out, width, height);
 
-    int errorCode = decodePNG(out, width, height, &(in[0]), in.size());
+    return createTexture(out, width, height);
+}
 
-    // check for errors
-    if (errorCode != 0) {
-        throw SDLException("Decode PNG failed with error: " + std::to_string(errorCode));
-    }
+GLTexture ImageLoader::createTexture(const std::vector<unsigned char>& pixels, int width, int height) {
+    // initialize struct components to 0 (use {})
+    GLTexture texture;
 
     // set width, height of texture
     texture.width = width;
     texture.height = height;
 
+    // texture is not in texture array yet
+    texture.arrayID = 0;
+    texture.layer = 0;
+
     // generate texture object
-    glGenTextures(1, &(texture.ID));
+    GraphicsBackend::get().genTextures(1, &(texture.ID));
 
     // bind texture
-    glBindTexture(GL_TEXTURE_2D, texture.ID);
+    GLState::bindTexture(GL_TEXTURE_2D, texture.ID);
 
     // upload image data to texture
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, &(out[0]));
+    GraphicsBackend::get().texImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, &(pixels[0]));
 
     // some texture params (wtf xd)
-    glTextureParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTextureParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTextureParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTextureParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    GraphicsBackend::get().textureParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    GraphicsBackend::get().textureParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    GraphicsBackend::get().textureParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    GraphicsBackend::get().textureParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
 
     // generate mipmap based on upper parameters
-    glGenerateMipmap(GL_TEXTURE_2D);
+    GraphicsBackend::get().generateMipmap(GL_TEXTURE_2D);
 
     // unbind texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    GLState::bindTexture(GL_TEXTURE_2D, 0);
 
     return texture;
 }
 
+void ImageLoader::loadPixels(std::string filePath, std::vector<unsigned char>& pixels, int& width, int& height) {
+    // input data
+    std::vector<unsigned char> in;
+
+    // image props
+    unsigned long imageWidth;
+    unsigned long imageHeight;
+
+    // read data to input buffer
+    if (IOManager::readFileToBuffer(filePath, in) == false) {
+        throw SDLException("Failed to read PNG file to buffer.");
+    }
+
+    int errorCode = decodePNG(pixels, imageWidth, imageHeight, &(in[0]), in.size());
+
+    // check for errors
+    if (errorCode != 0) {
+        throw SDLException("Decode PNG failed with error: " + std::to_string(errorCode));
+    }
+
+    width = imageWidth;
+    height = imageHeight;
+}
+
 Image ImageLoader::loadImage(std::string filePath) {
     std::vector<unsigned char> input;
     std::vector<unsigned char> output;
@@ -8,6 +8,8 @@ class ImageLoader
 {
 public:
 	static GLTexture loadTexture(std::string filePath);
+	static GLTexture createTexture(const std::vector<unsigned char>& pixels, int width, int height);
+	static void loadPixels(std::string filePath, std::vector<unsigned char>& pixels, int& width, int& height);
 	static Image loadImage(std::string filePath);
 };
 
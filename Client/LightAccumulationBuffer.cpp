@@ -0,0 +1,170 @@
+#include "LightAccumulationBuffer.h"
+#include "GLState.h"
+#include "SDLException.h"
+#include "EngineConfig.h"
+#include "GraphicsBackend.h"
+#include <glm/glm.hpp>
+
+LightAccumulationBuffer::LightAccumulationBuffer() : frameBufferID(0), textureID(0), vertexArrayID(0), width(0), height(0), scale(LIGHT_SCALE), averageFrameTime(LIGHT_TARGET_FRAME_TIME), frames(0), dynamic(true) {
+
+}
+
+// init
+void LightAccumulationBuffer::init(int width, int height) {
+	if (check()) {
+		this->width = width;
+		this->height = height;
+
+		initTexture();
+		initFrameBuffer();
+		initShaderProgram();
+
+		// fullscreen triangle has no attributes, but core profile can't draw without vertex array
+		GraphicsBackend::get().genVertexArrays(1, &vertexArrayID);
+	}
+}
+
+void LightAccumulationBuffer::initTexture() {
+	GraphicsBackend::get().genTextures(1, &textureID);
+	GLState::bindTexture(GL_TEXTURE_2D, textureID);
+
+	GraphicsBackend::get().texImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+	// linear filter does the upsampling, edges must not wrap to the other side of the screen
+	GraphicsBackend::get().texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	GraphicsBackend::get().texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	GraphicsBackend::get().texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	GraphicsBackend::get().texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+
+	GLState::bindTexture(GL_TEXTURE_2D, 0);
+}
+
+void LightAccumulationBuffer::initFrameBuffer() {
+	GraphicsBackend::get().genFramebuffers(1, &frameBufferID);
+	GraphicsBackend::get().bindFramebuffer(GL_FRAMEBUFFER, frameBufferID);
+	GraphicsBackend::get().framebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureID, 0);
+
+	GLenum status = GraphicsBackend::get().checkFramebufferStatus(GL_FRAMEBUFFER);
+	GraphicsBackend::get().bindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		throw SDLException(FRAMEBUFFER_ERROR);
+	}
+}
+
+void LightAccumulationBuffer::initShaderProgram() {
+	compositeProgram.init(COMPOSITE_VERTEX_PATH, COMPOSITE_FRAGMENT_PATH);
+	compositeProgram.linkShaders();
+
+	// sampler uniforms keep their value, so texture unit is set once after linking
+	compositeProgram.use();
+	GraphicsBackend::get().uniform1i(compositeProgram.getUniformValueLocation("lightMap"), 0);
+	GLState::useProgram(0);
+}
+
+void LightAccumulationBuffer::resize(int width, int height) {
+	if (this->width == width && this->height == height) {
+		return;
+	}
+
+	this->width = width;
+	this->height = height;
+
+	// attachment keeps pointing to the same texture, only its storage is replaced
+	GLState::bindTexture(GL_TEXTURE_2D, textureID);
+	GraphicsBackend::get().texImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	GLState::bindTexture(GL_TEXTURE_2D, 0);
+}
+
+// update
+void LightAccumulationBuffer::update(float frameTime) {
+	averageFrameTime = averageFrameTime + (frameTime - averageFrameTime) * LIGHT_FRAME_TIME_SMOOTHING;
+
+	if (!dynamic || ++frames < LIGHT_SCALE_INTERVAL) {
+		return;
+	}
+
+	frames = 0;
+
+	// thresholds are apart, so the scale does not jump between two steps every interval
+	if (averageFrameTime > LIGHT_TARGET_FRAME_TIME * LIGHT_SCALE_DOWN_THRESHOLD) {
+		setScale(scale - LIGHT_SCALE_STEP);
+	}
+	else if (averageFrameTime < LIGHT_TARGET_FRAME_TIME * LIGHT_SCALE_UP_THRESHOLD) {
+		setScale(scale + LIGHT_SCALE_STEP);
+	}
+}
+
+// begin / end
+void LightAccumulationBuffer::begin() {
+	GraphicsBackend::get().bindFramebuffer(GL_FRAMEBUFFER, frameBufferID);
+	GraphicsBackend::get().viewport(0, 0, getScaledWidth(), getScaledHeight());
+
+	// cleared with the clear color set by the game, lights are added to it as before
+	GraphicsBackend::get().clear(GL_COLOR_BUFFER_BIT);
+}
+
+void LightAccumulationBuffer::end() {
+	GraphicsBackend::get().bindFramebuffer(GL_FRAMEBUFFER, 0);
+	GraphicsBackend::get().viewport(0, 0, width, height);
+
+	composite();
+}
+
+// draw
+void LightAccumulationBuffer::composite() {
+	float scaleX = (float)getScaledWidth() / width;
+	float scaleY = (float)getScaledHeight() / height;
+
+	compositeProgram.use();
+	GraphicsBackend::get().uniform2f(compositeProgram.getUniformValueLocation("lightScale"), scaleX, scaleY);
+	GraphicsBackend::get().uniform2f(compositeProgram.getUniformValueLocation("lightLimit"), scaleX - 0.5f / width, scaleY - 0.5f / height);
+
+	GLState::activeTexture(GL_TEXTURE0);
+	GLState::bindTexture(GL_TEXTURE_2D, textureID);
+
+	// lighting replaces whatever the game cleared the screen with
+	GLState::blendFunc(GL_ONE, GL_ZERO);
+
+	GLState::bindVertexArray(vertexArrayID);
+	GraphicsBackend::get().drawArrays(GL_TRIANGLES, 0, 3);
+}
+
+// setters
+void LightAccumulationBuffer::setScale(float scale) {
+	this->scale = glm::clamp(scale, MIN_LIGHT_SCALE, MAX_LIGHT_SCALE);
+}
+
+void LightAccumulationBuffer::setDynamic(bool dynamic) {
+	this->dynamic = dynamic;
+}
+
+// getters
+GLuint LightAccumulationBuffer::getTextureID() const {
+	return textureID;
+}
+
+int LightAccumulationBuffer::getWidth() const {
+	return width;
+}
+
+int LightAccumulationBuffer::getHeight() const {
+	return height;
+}
+
+int LightAccumulationBuffer::getScaledWidth() const {
+	return glm::max((int)(width * scale + 0.5f), 1);
+}
+
+int LightAccumulationBuffer::getScaledHeight() const {
+	return glm::max((int)(height * scale + 0.5f), 1);
+}
+
+float LightAccumulationBuffer::getScale() const {
+	return scale;
+}
+
+// helper
+bool LightAccumulationBuffer::check() {
+	return frameBufferID == 0;
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "ShaderProgram.h"
+#include <GL/glew.h>
+
+#define LIGHT_SCALE 0.5f
+#define MIN_LIGHT_SCALE 0.25f
+#define MAX_LIGHT_SCALE 1.0f
+#define LIGHT_SCALE_STEP 0.125f
+#define LIGHT_TARGET_FRAME_TIME (1000.0f / 60.0f)
+// scale goes down above target * DOWN and up below target * UP
+#define LIGHT_SCALE_DOWN_THRESHOLD 1.2f
+#define LIGHT_SCALE_UP_THRESHOLD 1.05f
+// frames between two changes of the scale, gives the average time to settle
+#define LIGHT_SCALE_INTERVAL 30
+#define LIGHT_FRAME_TIME_SMOOTHING 0.1f
+
+// Offscreen target the lighting passes are drawn to. Texture has the size of the screen, but only
+// width * scale by height * scale pixels are rendered, so the scale can follow the frame time
+// without reallocating. end() upsamples the rendered part to the default framebuffer.
+class LightAccumulationBuffer
+{
+private:
+	GLuint frameBufferID;
+	GLuint textureID;
+	GLuint vertexArrayID;
+	ShaderProgram compositeProgram;
+	int width;
+	int height;
+	float scale;
+	float averageFrameTime;
+	int frames;
+	bool dynamic;
+public:
+	// constructors
+	LightAccumulationBuffer();
+
+	// init
+	void init(int width, int height);
+	void resize(int width, int height);
+
+	// update
+	void update(float frameTime);
+
+	// begin / end
+	void begin();
+	void end();
+
+	// setters
+	void setScale(float scale);
+	void setDynamic(bool dynamic);
+
+	// getters
+	GLuint getTextureID() const;
+	int getWidth() const;
+	int getHeight() const;
+	int getScaledWidth() const;
+	int getScaledHeight() const;
+	float getScale() const;
+private:
+	// init
+	void initTexture();
+	void initFrameBuffer();
+	void initShaderProgram();
+
+	// draw
+	void composite();
+
+	// helper
+	bool check();
+};
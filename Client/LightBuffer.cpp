@@ -0,0 +1,56 @@
+#include "LightBuffer.h"
+#include "GLState.h"
+#include "GraphicsBackend.h"
+#include <iostream>
+
+LightBuffer::LightBuffer() : bufferID(0), block(), overflowLogged(false) {
+
+}
+
+// init
+void LightBuffer::init() {
+	if (check()) {
+		GraphicsBackend::get().genBuffers(1, &bufferID);
+		GLState::bindBuffer(GL_UNIFORM_BUFFER, bufferID);
+		GraphicsBackend::get().bufferData(GL_UNIFORM_BUFFER, sizeof(LightBlock), nullptr, GL_DYNAMIC_DRAW);
+
+		// binding point is shared by every program which declares the block,
+		// it also binds the generic binding point which is already tracked by GLState
+		GraphicsBackend::get().bindBufferBase(GL_UNIFORM_BUFFER, LIGHT_BLOCK_BINDING, bufferID);
+		GLState::bindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+}
+
+// upload
+void LightBuffer::upload(const std::vector<Light*>& lights) {
+	// lights over the limit are drawn one by one by the renderer, but don't light shared geometry
+	block.lightCount = (GLint)glm::min(lights.size(), (size_t)MAX_LIGHTS);
+
+	if (lights.size() > MAX_LIGHTS && !overflowLogged) {
+		std::cout << "Light buffer holds " << MAX_LIGHTS << " lights, " << lights.size() - MAX_LIGHTS << " lights are drawn without shading the visible geometry" << std::endl;
+		overflowLogged = true;
+	}
+
+	for (int i = 0; i < block.lightCount; i++) {
+		Light* light = lights[i];
+		block.lights[i] = glm::vec4(light->getSource(), light->getRadius(), light->getIntensity());
+	}
+
+	GLState::bindBuffer(GL_UNIFORM_BUFFER, bufferID);
+	GraphicsBackend::get().bufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(LightBlock), &block);
+	GLState::bindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+// getters
+GLuint LightBuffer::getBufferID() const {
+	return bufferID;
+}
+
+int LightBuffer::getLightCount() const {
+	return block.lightCount;
+}
+
+// helper
+bool LightBuffer::check() {
+	return bufferID == 0;
+}
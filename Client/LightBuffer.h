@@ -0,0 +1,41 @@
+#pragma once
+#include "Light.h"
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+#define MAX_LIGHTS 32
+#define LIGHT_BLOCK_BINDING 0
+#define LIGHT_BLOCK_NAME "Lights"
+
+// std140 layout of the Lights uniform block in multiVisionGeometryShader.frag
+struct LightBlock {
+	glm::vec4 lights[MAX_LIGHTS];
+	GLint lightCount;
+	GLint padding[3];
+};
+
+// Uniform buffer with parameters of every light, uploaded once per frame.
+class LightBuffer
+{
+private:
+	GLuint bufferID;
+	LightBlock block;
+	bool overflowLogged;
+public:
+	// constructors
+	LightBuffer();
+
+	// init
+	void init();
+
+	// upload
+	void upload(const std::vector<Light*>& lights);
+
+	// getters
+	GLuint getBufferID() const;
+	int getLightCount() const;
+private:
+	// helper
+	bool check();
+};
@@ -0,0 +1,106 @@
+#include "LightmapBaker.h"
+#include "Collision.h"
+#include "ThreadPool.h"
+#include <cmath>
+
+// bake
+Lightmap LightmapBaker::bake(const Light& light, const std::vector<Square>& occluders, float texelSize) {
+	Lightmap lightmap;
+	lightmap.bounds = light.getBounds();
+	lightmap.width = glm::max((int)std::ceil(lightmap.bounds.getWidth() / texelSize), 1);
+	lightmap.height = glm::max((int)std::ceil(lightmap.bounds.getHeight() / texelSize), 1);
+	lightmap.pixels.resize((size_t)lightmap.width * lightmap.height * 4);
+
+	// only occluders inside of the light can cast a shadow on it
+	std::vector<Square> lightOccluders;
+	for (size_t i = 0; i < occluders.size(); i++) {
+		if (Collision::squareCollision(lightmap.bounds, occluders[i])) {
+			lightOccluders.push_back(occluders[i]);
+		}
+	}
+
+	int taskNumber = (lightmap.height + LIGHTMAP_ROWS_PER_TASK - 1) / LIGHTMAP_ROWS_PER_TASK;
+
+	// every task writes its own rows, so workers never touch the same texel
+	ThreadPool::run(taskNumber, [&](int task) {
+		int lastRow = glm::min((task + 1) * LIGHTMAP_ROWS_PER_TASK, lightmap.height);
+		for (int row = task * LIGHTMAP_ROWS_PER_TASK; row < lastRow; row++) {
+			bakeRow(lightmap, light, lightOccluders, texelSize, row);
+		}
+	});
+
+	return lightmap;
+}
+
+// helper
+void LightmapBaker::bakeRow(Lightmap& lightmap, const Light& light, const std::vector<Square>& occluders, float texelSize, int row) {
+	glm::vec2 source = light.getSource();
+	float radius = (float)light.getRadius();
+	Color color = light.getColor();
+
+	// the LIGHT pass weights the light by its own alpha, so falloff is applied twice
+	float alpha = color.a / 255.0f;
+
+	unsigned char* pixel = &lightmap.pixels[(size_t)row * lightmap.width * 4];
+
+	for (int column = 0; column < lightmap.width; column++, pixel += 4) {
+		glm::vec2 position = lightmap.bounds.getPosition() + (glm::vec2(column, row) + 0.5f) * texelSize;
+
+		// same falloff as visionGeometryShader.frag
+		float dist = glm::length(position - source) / radius;
+		float factor = glm::max(std::pow(0.01f, dist) - 0.01f, 0.0f);
+
+		// the visibility polygon covers whole bounds of the light, not only the lit circle
+		if (isOccluded(source, position, occluders)) {
+			pixel[0] = pixel[1] = pixel[2] = pixel[3] = 0;
+			continue;
+		}
+
+		float weight = factor * factor * alpha;
+
+		pixel[0] = (unsigned char)(color.r * weight + 0.5f);
+		pixel[1] = (unsigned char)(color.g * weight + 0.5f);
+		pixel[2] = (unsigned char)(color.b * weight + 0.5f);
+		pixel[3] = 255;
+	}
+}
+
+bool LightmapBaker::isOccluded(glm::vec2 source, glm::vec2 target, const std::vector<Square>& occluders) {
+	for (size_t i = 0; i < occluders.size(); i++) {
+		if (segmentIntersection(source, target, occluders[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool LightmapBaker::segmentIntersection(glm::vec2 source, glm::vec2 target, const Square& square) {
+	glm::vec2 min = square.getPosition();
+	glm::vec2 max = min + square.getDimensions();
+	glm::vec2 direction = target - source;
+
+	// slab test, the segment is clipped by both axes of the square
+	float tMin = 0.0f;
+	float tMax = 1.0f;
+
+	for (int axis = 0; axis < 2; axis++) {
+		if (std::abs(direction[axis]) < 1e-6f) {
+			if (source[axis] < min[axis] || source[axis] > max[axis]) {
+				return false;
+			}
+			continue;
+		}
+
+		float t1 = (min[axis] - source[axis]) / direction[axis];
+		float t2 = (max[axis] - source[axis]) / direction[axis];
+
+		tMin = glm::max(tMin, glm::min(t1, t2));
+		tMax = glm::min(tMax, glm::max(t1, t2));
+
+		if (tMin > tMax) {
+			return false;
+		}
+	}
+
+	return true;
+}
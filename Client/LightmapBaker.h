@@ -0,0 +1,31 @@
+#pragma once
+#include "Light.h"
+#include "Square.h"
+#include <glm/glm.hpp>
+#include <vector>
+
+#define LIGHTMAP_TEXEL_SIZE 4.0f
+#define LIGHTMAP_ROWS_PER_TASK 8
+
+// shadowed falloff of one light, RGBA8 rows start at the bottom edge of bounds
+struct Lightmap {
+	Square bounds;
+	int width;
+	int height;
+	std::vector<unsigned char> pixels;
+};
+
+// Bakes lights which never move on the CPU, rows are shared between ThreadPool workers.
+// Texel color is what the LIGHT pass adds for the light at intensity 1, alpha marks texels
+// which are visible from the light and replaces its visibility polygon in the alpha mask.
+class LightmapBaker
+{
+public:
+	// bake
+	static Lightmap bake(const Light& light, const std::vector<Square>& occluders, float texelSize = LIGHTMAP_TEXEL_SIZE);
+private:
+	// helper
+	static void bakeRow(Lightmap& lightmap, const Light& light, const std::vector<Square>& occluders, float texelSize, int row);
+	static bool isOccluded(glm::vec2 source, glm::vec2 target, const std::vector<Square>& occluders);
+	static bool segmentIntersection(glm::vec2 source, glm::vec2 target, const Square& square);
+};
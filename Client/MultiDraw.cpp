@@ -0,0 +1,88 @@
+#include "MultiDraw.h"
+#include "GraphicsBackend.h"
+
+MultiDraw::MultiDraw() : mode(GL_TRIANGLES), indexed(false), drawCalls(0) {
+
+}
+
+// add
+void MultiDraw::addArrays(GLenum mode, GLint first, GLsizei count) {
+	if (!isCompatible(mode, false)) {
+		draw();
+	}
+
+	this->mode = mode;
+	indexed = false;
+
+	firsts.push_back(first);
+	counts.push_back(count);
+}
+
+void MultiDraw::addElements(GLenum mode, GLsizei count, GLint baseVertex) {
+	if (!isCompatible(mode, true)) {
+		draw();
+	}
+
+	this->mode = mode;
+	indexed = true;
+
+	// every range starts at the beginning of the index buffer, base vertex selects the vertices
+	counts.push_back(count);
+	baseVertices.push_back(baseVertex);
+	indices.push_back(nullptr);
+}
+
+// draw
+void MultiDraw::draw() {
+	if (isEmpty()) {
+		return;
+	}
+
+	GLsizei drawCount = (GLsizei)counts.size();
+
+	if (indexed) {
+		if (drawCount == 1) {
+			GraphicsBackend::get().drawElementsBaseVertex(mode, counts[0], GL_UNSIGNED_INT, nullptr, baseVertices[0]);
+		}
+		else {
+			GraphicsBackend::get().multiDrawElementsBaseVertex(mode, counts.data(), GL_UNSIGNED_INT, indices.data(), drawCount, baseVertices.data());
+		}
+	}
+	else {
+		if (drawCount == 1) {
+			GraphicsBackend::get().drawArrays(mode, firsts[0], counts[0]);
+		}
+		else {
+			GraphicsBackend::get().multiDrawArrays(mode, firsts.data(), counts.data(), drawCount);
+		}
+	}
+
+	drawCalls++;
+	clear();
+}
+
+// getters
+bool MultiDraw::isEmpty() const {
+	return counts.empty();
+}
+
+int MultiDraw::getDrawCalls() const {
+	return drawCalls;
+}
+
+// reset
+void MultiDraw::resetDrawCalls() {
+	drawCalls = 0;
+}
+
+// helper
+bool MultiDraw::isCompatible(GLenum mode, bool indexed) const {
+	return isEmpty() || (this->mode == mode && this->indexed == indexed);
+}
+
+void MultiDraw::clear() {
+	firsts.clear();
+	counts.clear();
+	baseVertices.clear();
+	indices.clear();
+}
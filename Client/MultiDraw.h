@@ -0,0 +1,38 @@
+#pragma once
+#include <GL/glew.h>
+#include <vector>
+
+// Collects draw ranges with the same primitive mode and submits them with one
+// glMultiDrawArrays / glMultiDrawElementsBaseVertex call.
+class MultiDraw
+{
+private:
+	std::vector<GLint> firsts;
+	std::vector<GLsizei> counts;
+	std::vector<GLint> baseVertices;
+	std::vector<const void*> indices;
+	GLenum mode;
+	bool indexed;
+	int drawCalls;
+public:
+	// constructors
+	MultiDraw();
+
+	// add
+	void addArrays(GLenum mode, GLint first, GLsizei count);
+	void addElements(GLenum mode, GLsizei count, GLint baseVertex);
+
+	// draw
+	void draw();
+
+	// getters
+	bool isEmpty() const;
+	int getDrawCalls() const;
+
+	// reset
+	void resetDrawCalls();
+private:
+	// helper
+	bool isCompatible(GLenum mode, bool indexed) const;
+	void clear();
+};
@@ -0,0 +1,14 @@
+#include "NetworkCounters.h"
+#include "Counters.h"
+#include <InputStream.h>
+#include <OutputStream.h>
+
+static Counter receivedBytes("Network bytes received");
+static Counter sentBytes("Network bytes sent");
+
+// update
+void NetworkCounters::update() {
+	// counters hold the totals already added, so only the difference of this frame is added
+	receivedBytes.add(InputStream::getReceivedBytes() - receivedBytes.getTotal());
+	sentBytes.add(OutputStream::getSentBytes() - sentBytes.getTotal());
+}
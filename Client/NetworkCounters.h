@@ -0,0 +1,10 @@
+#pragma once
+
+// Feeds byte totals of NetworkLibrary streams to Counters. Streams keep their own atomic totals,
+// update() is called once per frame before Counters::snapshot() and adds what changed since then.
+class NetworkCounters
+{
+public:
+	// update
+	static void update();
+};
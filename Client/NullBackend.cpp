@@ -0,0 +1,531 @@
+#include "NullBackend.h"
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+NullBackend::NullBackend() : statistics(), commands(), recording(false), nextName(1) {
+
+}
+
+// statistics
+void NullBackend::resetStatistics() {
+	statistics = GraphicsStatistics();
+}
+
+const GraphicsStatistics& NullBackend::getStatistics() const {
+	return statistics;
+}
+
+// recording
+void NullBackend::setRecording(bool recording) {
+	this->recording = recording;
+}
+
+void NullBackend::clearCommands() {
+	commands.clear();
+}
+
+const std::vector<GraphicsCommand>& NullBackend::getCommands() const {
+	return commands;
+}
+
+// buffers
+void NullBackend::genBuffers(GLsizei n, GLuint* buffers) {
+	generateNames(n, buffers);
+
+	// buffers get system memory storage, so they can be mapped
+	for (GLsizei i = 0; i < n; i++) {
+		this->buffers[buffers[i]];
+	}
+}
+
+void NullBackend::deleteBuffers(GLsizei n, const GLuint* buffers) {
+	for (GLsizei i = 0; i < n; i++) {
+		this->buffers.erase(buffers[i]);
+	}
+}
+
+void NullBackend::bindBuffer(GLenum target, GLuint buffer) {
+	boundBuffers[target] = buffer;
+	statistics.stateChanges++;
+	record("bindBuffer", target, buffer);
+}
+
+void NullBackend::bindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	statistics.stateChanges++;
+	record("bindBufferBase", target, index, buffer);
+}
+
+void NullBackend::bufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
+	std::vector<GLubyte>* buffer = getBoundBuffer(target);
+	if (buffer == nullptr) {
+		return;
+	}
+
+	buffer->assign((size_t)size, 0);
+
+	if (data != nullptr) {
+		std::memcpy(buffer->data(), data, (size_t)size);
+		statistics.uploadedBytes += size;
+	}
+	record("bufferData", target, size, usage);
+}
+
+void NullBackend::bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+	std::vector<GLubyte>* buffer = getBoundBuffer(target);
+	if (buffer == nullptr || offset + size > (GLintptr)buffer->size()) {
+		return;
+	}
+
+	std::memcpy(buffer->data() + offset, data, (size_t)size);
+	statistics.uploadedBytes += size;
+	record("bufferSubData", target, offset, size);
+}
+
+void NullBackend::bufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield /*flags*/) {
+	bufferData(target, size, data, GL_STATIC_DRAW);
+}
+
+void* NullBackend::mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	std::vector<GLubyte>* buffer = getBoundBuffer(target);
+	if (buffer == nullptr || offset + length > (GLintptr)buffer->size()) {
+		return nullptr;
+	}
+
+	// whole mapped range is counted, the engine writes every byte it maps
+	if (access & GL_MAP_WRITE_BIT) {
+		statistics.uploadedBytes += length;
+	}
+	record("mapBufferRange", target, offset, length, access);
+
+	return buffer->data() + offset;
+}
+
+GLboolean NullBackend::unmapBuffer(GLenum /*target*/) {
+	return GL_TRUE;
+}
+
+void NullBackend::copyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	std::vector<GLubyte>* source = getBoundBuffer(readTarget);
+	std::vector<GLubyte>* destination = getBoundBuffer(writeTarget);
+
+	if (source == nullptr || destination == nullptr) {
+		return;
+	}
+
+	if (readOffset + size > (GLintptr)source->size() || writeOffset + size > (GLintptr)destination->size()) {
+		return;
+	}
+
+	std::memmove(destination->data() + writeOffset, source->data() + readOffset, (size_t)size);
+	record("copyBufferSubData", readTarget, writeTarget, size);
+}
+
+// vertex arrays
+void NullBackend::genVertexArrays(GLsizei n, GLuint* arrays) {
+	generateNames(n, arrays);
+}
+
+void NullBackend::deleteVertexArrays(GLsizei /*n*/, const GLuint* /*arrays*/) {
+	// nothing to do without GPU
+}
+
+void NullBackend::bindVertexArray(GLuint array) {
+	statistics.stateChanges++;
+	record("bindVertexArray", array);
+}
+
+void NullBackend::enableVertexAttribArray(GLuint index) {
+	statistics.stateChanges++;
+	record("enableVertexAttribArray", index);
+}
+
+void NullBackend::vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei /*stride*/, const void* /*pointer*/) {
+	statistics.stateChanges++;
+	record("vertexAttribPointer", index, size, type, normalized);
+}
+
+void NullBackend::vertexAttribDivisor(GLuint index, GLuint divisor) {
+	statistics.stateChanges++;
+	record("vertexAttribDivisor", index, divisor);
+}
+
+// textures
+void NullBackend::genTextures(GLsizei n, GLuint* textures) {
+	generateNames(n, textures);
+}
+
+void NullBackend::deleteTextures(GLsizei /*n*/, const GLuint* /*textures*/) {
+	// nothing to do without GPU
+}
+
+void NullBackend::activeTexture(GLenum texture) {
+	statistics.stateChanges++;
+	record("activeTexture", texture);
+}
+
+void NullBackend::bindTexture(GLenum target, GLuint texture) {
+	statistics.stateChanges++;
+	record("bindTexture", target, texture);
+}
+
+void NullBackend::texImage2D(GLenum target, GLint /*level*/, GLint /*internalFormat*/, GLsizei width, GLsizei height, GLint /*border*/, GLenum /*format*/, GLenum /*type*/, const void* pixels) {
+	statistics.uploadedBytes += getImageSize(width, height, 1, pixels);
+	record("texImage2D", target, width, height);
+}
+
+void NullBackend::texImage3D(GLenum target, GLint /*level*/, GLint /*internalFormat*/, GLsizei width, GLsizei height, GLsizei depth, GLint /*border*/, GLenum /*format*/, GLenum /*type*/, const void* pixels) {
+	statistics.uploadedBytes += getImageSize(width, height, depth, pixels);
+	record("texImage3D", target, width, height, depth);
+}
+
+void NullBackend::texSubImage3D(GLenum target, GLint /*level*/, GLint /*xOffset*/, GLint /*yOffset*/, GLint zOffset, GLsizei width, GLsizei height, GLsizei depth, GLenum /*format*/, GLenum /*type*/, const void* pixels) {
+	statistics.uploadedBytes += getImageSize(width, height, depth, pixels);
+	record("texSubImage3D", target, zOffset, width, height);
+}
+
+void NullBackend::texParameteri(GLenum /*target*/, GLenum /*name*/, GLint /*param*/) {
+	// nothing to do without GPU
+}
+
+void NullBackend::textureParameteri(GLuint /*texture*/, GLenum /*name*/, GLint /*param*/) {
+	// nothing to do without GPU
+}
+
+void NullBackend::generateMipmap(GLenum /*target*/) {
+	// nothing to do without GPU
+}
+
+// framebuffers
+void NullBackend::genFramebuffers(GLsizei n, GLuint* framebuffers) {
+	generateNames(n, framebuffers);
+}
+
+void NullBackend::deleteFramebuffers(GLsizei /*n*/, const GLuint* /*framebuffers*/) {
+	// nothing to do without GPU
+}
+
+void NullBackend::bindFramebuffer(GLenum target, GLuint framebuffer) {
+	statistics.stateChanges++;
+	record("bindFramebuffer", target, framebuffer);
+}
+
+void NullBackend::framebufferTexture2D(GLenum target, GLenum attachment, GLenum /*textureTarget*/, GLuint texture, GLint /*level*/) {
+	record("framebufferTexture2D", target, attachment, texture);
+}
+
+GLenum NullBackend::checkFramebufferStatus(GLenum /*target*/) {
+	// attachments are never checked, so every framebuffer is complete
+	return GL_FRAMEBUFFER_COMPLETE;
+}
+
+// shaders
+GLuint NullBackend::createShader(GLenum /*type*/) {
+	return nextName++;
+}
+
+void NullBackend::shaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length) {
+	std::string& source = shaderSources[shader];
+	source.clear();
+
+	for (GLsizei i = 0; i < count; i++) {
+		if (length != nullptr && length[i] >= 0) {
+			source.append(string[i], (size_t)length[i]);
+		}
+		else {
+			source.append(string[i]);
+		}
+	}
+}
+
+void NullBackend::compileShader(GLuint /*shader*/) {
+	// nothing to do without GPU
+}
+
+void NullBackend::getShaderiv(GLuint /*shader*/, GLenum name, GLint* params) {
+	// every shader compiles, there is no info log
+	*params = name == GL_COMPILE_STATUS ? GL_TRUE : 0;
+}
+
+void NullBackend::getShaderInfoLog(GLuint /*shader*/, GLsizei bufferSize, GLsizei* length, GLchar* infoLog) {
+	if (length != nullptr) {
+		*length = 0;
+	}
+	if (bufferSize > 0) {
+		infoLog[0] = '\0';
+	}
+}
+
+void NullBackend::deleteShader(GLuint shader) {
+	shaderSources.erase(shader);
+}
+
+GLuint NullBackend::createProgram() {
+	return nextName++;
+}
+
+void NullBackend::attachShader(GLuint program, GLuint shader) {
+	programShaders[program].push_back(shader);
+}
+
+void NullBackend::detachShader(GLuint /*program*/, GLuint /*shader*/) {
+	// nothing to do without GPU
+}
+
+void NullBackend::linkProgram(GLuint program) {
+	parseUniforms(program);
+}
+
+void NullBackend::getProgramiv(GLuint program, GLenum name, GLint* params) {
+	const std::vector<std::string>& uniforms = programUniforms[program];
+
+	switch (name) {
+	case GL_LINK_STATUS:
+		*params = GL_TRUE;
+		break;
+	case GL_ACTIVE_UNIFORMS:
+		*params = (GLint)uniforms.size();
+		break;
+	case GL_ACTIVE_UNIFORM_MAX_LENGTH: {
+		size_t maxLength = 0;
+		for (const std::string& uniform : uniforms) {
+			maxLength = std::max(maxLength, uniform.size() + 1);
+		}
+		*params = (GLint)maxLength;
+		break;
+	}
+	default:
+		*params = 0;
+		break;
+	}
+}
+
+void NullBackend::bindAttribLocation(GLuint /*program*/, GLuint /*index*/, const GLchar* /*name*/) {
+	// nothing to do without GPU
+}
+
+void NullBackend::getActiveUniform(GLuint program, GLuint index, GLsizei bufferSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name) {
+	const std::vector<std::string>& uniforms = programUniforms[program];
+	std::string uniform = index < uniforms.size() ? uniforms[index] : std::string();
+
+	GLsizei copied = bufferSize > 0 ? std::min((GLsizei)uniform.size(), bufferSize - 1) : 0;
+	if (bufferSize > 0) {
+		std::memcpy(name, uniform.c_str(), (size_t)copied);
+		name[copied] = '\0';
+	}
+
+	if (length != nullptr) {
+		*length = copied;
+	}
+	*size = 1;
+	*type = GL_FLOAT;
+}
+
+GLint NullBackend::getUniformLocation(GLuint program, const GLchar* name) {
+	const std::vector<std::string>& uniforms = programUniforms[program];
+
+	for (size_t i = 0; i < uniforms.size(); i++) {
+		if (uniforms[i] == name) {
+			return (GLint)i;
+		}
+	}
+	return -1;
+}
+
+GLuint NullBackend::getUniformBlockIndex(GLuint /*program*/, const GLchar* /*name*/) {
+	// every block exists, bindings are not used without GPU
+	return 0;
+}
+
+void NullBackend::uniformBlockBinding(GLuint /*program*/, GLuint /*blockIndex*/, GLuint /*binding*/) {
+	// nothing to do without GPU
+}
+
+void NullBackend::useProgram(GLuint program) {
+	statistics.stateChanges++;
+	record("useProgram", program);
+}
+
+// uniforms
+void NullBackend::uniform1i(GLint location, GLint value) {
+	statistics.stateChanges++;
+	record("uniform1i", location, value);
+}
+
+void NullBackend::uniform1f(GLint location, GLfloat /*value*/) {
+	statistics.stateChanges++;
+	record("uniform1f", location);
+}
+
+void NullBackend::uniform2f(GLint location, GLfloat /*x*/, GLfloat /*y*/) {
+	statistics.stateChanges++;
+	record("uniform2f", location);
+}
+
+// draw
+void NullBackend::drawArrays(GLenum mode, GLint first, GLsizei count) {
+	statistics.drawCalls++;
+	record("drawArrays", mode, first, count);
+}
+
+void NullBackend::drawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* /*indices*/, GLint baseVertex) {
+	statistics.drawCalls++;
+	record("drawElementsBaseVertex", mode, count, type, baseVertex);
+}
+
+void NullBackend::multiDrawArrays(GLenum mode, const GLint* /*first*/, const GLsizei* /*count*/, GLsizei drawCount) {
+	statistics.drawCalls++;
+	record("multiDrawArrays", mode, drawCount);
+}
+
+void NullBackend::multiDrawElementsBaseVertex(GLenum mode, const GLsizei* /*count*/, GLenum type, const void* const* /*indices*/, GLsizei drawCount, const GLint* /*baseVertex*/) {
+	statistics.drawCalls++;
+	record("multiDrawElementsBaseVertex", mode, type, drawCount);
+}
+
+void NullBackend::drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount) {
+	statistics.drawCalls++;
+	record("drawArraysInstanced", mode, first, count, instanceCount);
+}
+
+void NullBackend::drawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount, GLuint /*baseInstance*/) {
+	statistics.drawCalls++;
+	record("drawArraysInstancedBaseInstance", mode, first, count, instanceCount);
+}
+
+// sync
+GLsync NullBackend::fenceSync(GLenum /*condition*/, GLbitfield /*flags*/) {
+	return (GLsync)(size_t)nextName++;
+}
+
+GLenum NullBackend::clientWaitSync(GLsync /*sync*/, GLbitfield /*flags*/, GLuint64 /*timeout*/) {
+	// nothing is ever in flight
+	return GL_ALREADY_SIGNALED;
+}
+
+void NullBackend::deleteSync(GLsync /*sync*/) {
+	// nothing to do without GPU
+}
+
+// queries
+void NullBackend::genQueries(GLsizei n, GLuint* queries) {
+	generateNames(n, queries);
+}
+
+void NullBackend::deleteQueries(GLsizei /*n*/, const GLuint* /*queries*/) {
+	// nothing to do without GPU
+}
+
+void NullBackend::beginQuery(GLenum target, GLuint query) {
+	record("beginQuery", target, query);
+}
+
+void NullBackend::endQuery(GLenum target) {
+	record("endQuery", target);
+}
+
+void NullBackend::getQueryObjectiv(GLuint /*query*/, GLenum name, GLint* params) {
+	// every query is finished at once
+	*params = name == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;
+}
+
+void NullBackend::getQueryObjectui64v(GLuint /*query*/, GLenum /*name*/, GLuint64* params) {
+	// nothing takes GPU time
+	*params = 0;
+}
+
+// frame
+void NullBackend::blendFuncSeparate(GLenum sourceRGB, GLenum destinationRGB, GLenum sourceAlpha, GLenum destinationAlpha) {
+	statistics.stateChanges++;
+	record("blendFuncSeparate", sourceRGB, destinationRGB, sourceAlpha, destinationAlpha);
+}
+
+void NullBackend::enable(GLenum capability) {
+	statistics.stateChanges++;
+	record("enable", capability);
+}
+
+void NullBackend::viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	statistics.stateChanges++;
+	record("viewport", x, y, width, height);
+}
+
+void NullBackend::clearColor(GLfloat /*red*/, GLfloat /*green*/, GLfloat /*blue*/, GLfloat /*alpha*/) {
+	statistics.stateChanges++;
+	record("clearColor");
+}
+
+void NullBackend::clearDepth(GLdouble /*depth*/) {
+	statistics.stateChanges++;
+	record("clearDepth");
+}
+
+void NullBackend::clear(GLbitfield /*mask*/) {
+	// nothing to do without GPU
+}
+
+// helper
+void NullBackend::record(const char* name, long long first, long long second, long long third, long long fourth) {
+	if (!recording) {
+		return;
+	}
+
+	GraphicsCommand command;
+	command.name = name;
+	command.arguments[0] = first;
+	command.arguments[1] = second;
+	command.arguments[2] = third;
+	command.arguments[3] = fourth;
+
+	commands.push_back(command);
+}
+
+void NullBackend::generateNames(GLsizei n, GLuint* names) {
+	for (GLsizei i = 0; i < n; i++) {
+		names[i] = nextName++;
+	}
+}
+
+void NullBackend::parseUniforms(GLuint program) {
+	std::vector<std::string>& uniforms = programUniforms[program];
+	uniforms.clear();
+
+	// plain "uniform type name;" declarations, uniform blocks have no location
+	for (GLuint shader : programShaders[program]) {
+		std::istringstream stream(shaderSources[shader]);
+		std::string line;
+
+		while (std::getline(stream, line)) {
+			size_t start = line.find_first_not_of(" \t");
+			if (start == std::string::npos || line.compare(start, 8, "uniform ") != 0 || line.find('{') != std::string::npos) {
+				continue;
+			}
+
+			std::istringstream words(line.substr(start));
+			std::string keyword, type, name;
+			words >> keyword >> type >> name;
+
+			name = name.substr(0, name.find_first_of(";["));
+
+			if (!name.empty() && std::find(uniforms.begin(), uniforms.end(), name) == uniforms.end()) {
+				uniforms.push_back(name);
+			}
+		}
+	}
+}
+
+std::vector<GLubyte>* NullBackend::getBoundBuffer(GLenum target) {
+	auto it = buffers.find(boundBuffers[target]);
+	if (it == buffers.end()) {
+		return nullptr;
+	}
+	return &it->second;
+}
+
+long long NullBackend::getImageSize(GLsizei width, GLsizei height, GLsizei depth, const void* pixels) {
+	// the engine uploads RGBA images with one byte per channel
+	if (pixels == nullptr) {
+		return 0;
+	}
+	return (long long)width * height * depth * 4;
+}
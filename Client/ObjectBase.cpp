@@ -1,4 +1,5 @@
 #include "ObjectBase.h"
+#include "GLState.h"
 #include "ResourceManager.h"
 #include <cstddef>
 
@@ -35,13 +36,13 @@ void ObjectBase::loadTexture(std::string textureFilePath)
 
 void ObjectBase::updoadVertexData(Vertex *vertexData)
 {
-	glBindBuffer(GL_ARRAY_BUFFER, objectID);
+	GLState::bindBuffer(GL_ARRAY_BUFFER, objectID);
 
 	// send data to binded buffer object
 	glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * 6, vertexData, GL_STREAM_DRAW);
 
 	// 0 means no buffer
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 Vertex *ObjectBase::createVertices()
@@ -92,7 +93,7 @@ void ObjectBase::draw()
 void ObjectBase::drawVertices()
 {
 	// bind buffer object to GL_ARRAY_BUFFER
-	glBindBuffer(GL_ARRAY_BUFFER, objectID);
+	GLState::bindBuffer(GL_ARRAY_BUFFER, objectID);
 
 	// enable position attribute
 	// tell GL what kind of attributes we are giving to him
@@ -130,19 +131,19 @@ void ObjectBase::drawVertices()
 	glDisableVertexAttribArray(2);
 
 	// unbind buffer when finished, 0 means no buffer
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 void ObjectBase::bindTexture()
 {
 	// you can bind more active textures, just increase number
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, texture.ID);
+	GLState::activeTexture(GL_TEXTURE0);
+	GLState::bindTexture(GL_TEXTURE_2D, texture.ID);
 }
 
 void ObjectBase::unbindTexture()
 {
-	glBindTexture(GL_TEXTURE_2D, 0);
+	GLState::bindTexture(GL_TEXTURE_2D, 0);
 }
 
 void ObjectBase::updatePosition(float x, float y)
@@ -0,0 +1,299 @@
+#include "OpenGLBackend.h"
+
+// buffers
+void OpenGLBackend::genBuffers(GLsizei n, GLuint* buffers) {
+	glGenBuffers(n, buffers);
+}
+
+void OpenGLBackend::deleteBuffers(GLsizei n, const GLuint* buffers) {
+	glDeleteBuffers(n, buffers);
+}
+
+void OpenGLBackend::bindBuffer(GLenum target, GLuint buffer) {
+	glBindBuffer(target, buffer);
+}
+
+void OpenGLBackend::bindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	glBindBufferBase(target, index, buffer);
+}
+
+void OpenGLBackend::bufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
+	glBufferData(target, size, data, usage);
+}
+
+void OpenGLBackend::bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+	glBufferSubData(target, offset, size, data);
+}
+
+void OpenGLBackend::bufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags) {
+	glBufferStorage(target, size, data, flags);
+}
+
+void* OpenGLBackend::mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	return glMapBufferRange(target, offset, length, access);
+}
+
+GLboolean OpenGLBackend::unmapBuffer(GLenum target) {
+	return glUnmapBuffer(target);
+}
+
+void OpenGLBackend::copyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+// vertex arrays
+void OpenGLBackend::genVertexArrays(GLsizei n, GLuint* arrays) {
+	glGenVertexArrays(n, arrays);
+}
+
+void OpenGLBackend::deleteVertexArrays(GLsizei n, const GLuint* arrays) {
+	glDeleteVertexArrays(n, arrays);
+}
+
+void OpenGLBackend::bindVertexArray(GLuint array) {
+	glBindVertexArray(array);
+}
+
+void OpenGLBackend::enableVertexAttribArray(GLuint index) {
+	glEnableVertexAttribArray(index);
+}
+
+void OpenGLBackend::vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer) {
+	glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+void OpenGLBackend::vertexAttribDivisor(GLuint index, GLuint divisor) {
+	glVertexAttribDivisor(index, divisor);
+}
+
+// textures
+void OpenGLBackend::genTextures(GLsizei n, GLuint* textures) {
+	glGenTextures(n, textures);
+}
+
+void OpenGLBackend::deleteTextures(GLsizei n, const GLuint* textures) {
+	glDeleteTextures(n, textures);
+}
+
+void OpenGLBackend::activeTexture(GLenum texture) {
+	glActiveTexture(texture);
+}
+
+void OpenGLBackend::bindTexture(GLenum target, GLuint texture) {
+	glBindTexture(target, texture);
+}
+
+void OpenGLBackend::texImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels) {
+	glTexImage2D(target, level, internalFormat, width, height, border, format, type, pixels);
+}
+
+void OpenGLBackend::texImage3D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels) {
+	glTexImage3D(target, level, internalFormat, width, height, depth, border, format, type, pixels);
+}
+
+void OpenGLBackend::texSubImage3D(GLenum target, GLint level, GLint xOffset, GLint yOffset, GLint zOffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels) {
+	glTexSubImage3D(target, level, xOffset, yOffset, zOffset, width, height, depth, format, type, pixels);
+}
+
+void OpenGLBackend::texParameteri(GLenum target, GLenum name, GLint param) {
+	glTexParameteri(target, name, param);
+}
+
+void OpenGLBackend::textureParameteri(GLuint texture, GLenum name, GLint param) {
+	glTextureParameteri(texture, name, param);
+}
+
+void OpenGLBackend::generateMipmap(GLenum target) {
+	glGenerateMipmap(target);
+}
+
+// framebuffers
+void OpenGLBackend::genFramebuffers(GLsizei n, GLuint* framebuffers) {
+	glGenFramebuffers(n, framebuffers);
+}
+
+void OpenGLBackend::deleteFramebuffers(GLsizei n, const GLuint* framebuffers) {
+	glDeleteFramebuffers(n, framebuffers);
+}
+
+void OpenGLBackend::bindFramebuffer(GLenum target, GLuint framebuffer) {
+	glBindFramebuffer(target, framebuffer);
+}
+
+void OpenGLBackend::framebufferTexture2D(GLenum target, GLenum attachment, GLenum textureTarget, GLuint texture, GLint level) {
+	glFramebufferTexture2D(target, attachment, textureTarget, texture, level);
+}
+
+GLenum OpenGLBackend::checkFramebufferStatus(GLenum target) {
+	return glCheckFramebufferStatus(target);
+}
+
+// shaders
+GLuint OpenGLBackend::createShader(GLenum type) {
+	return glCreateShader(type);
+}
+
+void OpenGLBackend::shaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length) {
+	glShaderSource(shader, count, string, length);
+}
+
+void OpenGLBackend::compileShader(GLuint shader) {
+	glCompileShader(shader);
+}
+
+void OpenGLBackend::getShaderiv(GLuint shader, GLenum name, GLint* params) {
+	glGetShaderiv(shader, name, params);
+}
+
+void OpenGLBackend::getShaderInfoLog(GLuint shader, GLsizei bufferSize, GLsizei* length, GLchar* infoLog) {
+	glGetShaderInfoLog(shader, bufferSize, length, infoLog);
+}
+
+void OpenGLBackend::deleteShader(GLuint shader) {
+	glDeleteShader(shader);
+}
+
+GLuint OpenGLBackend::createProgram() {
+	return glCreateProgram();
+}
+
+void OpenGLBackend::attachShader(GLuint program, GLuint shader) {
+	glAttachShader(program, shader);
+}
+
+void OpenGLBackend::detachShader(GLuint program, GLuint shader) {
+	glDetachShader(program, shader);
+}
+
+void OpenGLBackend::linkProgram(GLuint program) {
+	glLinkProgram(program);
+}
+
+void OpenGLBackend::getProgramiv(GLuint program, GLenum name, GLint* params) {
+	glGetProgramiv(program, name, params);
+}
+
+void OpenGLBackend::bindAttribLocation(GLuint program, GLuint index, const GLchar* name) {
+	glBindAttribLocation(program, index, name);
+}
+
+void OpenGLBackend::getActiveUniform(GLuint program, GLuint index, GLsizei bufferSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name) {
+	glGetActiveUniform(program, index, bufferSize, length, size, type, name);
+}
+
+GLint OpenGLBackend::getUniformLocation(GLuint program, const GLchar* name) {
+	return glGetUniformLocation(program, name);
+}
+
+GLuint OpenGLBackend::getUniformBlockIndex(GLuint program, const GLchar* name) {
+	return glGetUniformBlockIndex(program, name);
+}
+
+void OpenGLBackend::uniformBlockBinding(GLuint program, GLuint blockIndex, GLuint binding) {
+	glUniformBlockBinding(program, blockIndex, binding);
+}
+
+void OpenGLBackend::useProgram(GLuint program) {
+	glUseProgram(program);
+}
+
+// uniforms
+void OpenGLBackend::uniform1i(GLint location, GLint value) {
+	glUniform1i(location, value);
+}
+
+void OpenGLBackend::uniform1f(GLint location, GLfloat value) {
+	glUniform1f(location, value);
+}
+
+void OpenGLBackend::uniform2f(GLint location, GLfloat x, GLfloat y) {
+	glUniform2f(location, x, y);
+}
+
+// draw
+void OpenGLBackend::drawArrays(GLenum mode, GLint first, GLsizei count) {
+	glDrawArrays(mode, first, count);
+}
+
+void OpenGLBackend::drawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint baseVertex) {
+	glDrawElementsBaseVertex(mode, count, type, indices, baseVertex);
+}
+
+void OpenGLBackend::multiDrawArrays(GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawCount) {
+	glMultiDrawArrays(mode, first, count, drawCount);
+}
+
+void OpenGLBackend::multiDrawElementsBaseVertex(GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawCount, const GLint* baseVertex) {
+	glMultiDrawElementsBaseVertex(mode, count, type, indices, drawCount, baseVertex);
+}
+
+void OpenGLBackend::drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount) {
+	glDrawArraysInstanced(mode, first, count, instanceCount);
+}
+
+void OpenGLBackend::drawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount, GLuint baseInstance) {
+	glDrawArraysInstancedBaseInstance(mode, first, count, instanceCount, baseInstance);
+}
+
+// sync
+GLsync OpenGLBackend::fenceSync(GLenum condition, GLbitfield flags) {
+	return glFenceSync(condition, flags);
+}
+
+GLenum OpenGLBackend::clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	return glClientWaitSync(sync, flags, timeout);
+}
+
+void OpenGLBackend::deleteSync(GLsync sync) {
+	glDeleteSync(sync);
+}
+
+// queries
+void OpenGLBackend::genQueries(GLsizei n, GLuint* queries) {
+	glGenQueries(n, queries);
+}
+
+void OpenGLBackend::deleteQueries(GLsizei n, const GLuint* queries) {
+	glDeleteQueries(n, queries);
+}
+
+void OpenGLBackend::beginQuery(GLenum target, GLuint query) {
+	glBeginQuery(target, query);
+}
+
+void OpenGLBackend::endQuery(GLenum target) {
+	glEndQuery(target);
+}
+
+void OpenGLBackend::getQueryObjectiv(GLuint query, GLenum name, GLint* params) {
+	glGetQueryObjectiv(query, name, params);
+}
+
+void OpenGLBackend::getQueryObjectui64v(GLuint query, GLenum name, GLuint64* params) {
+	glGetQueryObjectui64v(query, name, params);
+}
+
+// frame
+void OpenGLBackend::blendFuncSeparate(GLenum sourceRGB, GLenum destinationRGB, GLenum sourceAlpha, GLenum destinationAlpha) {
+	glBlendFuncSeparate(sourceRGB, destinationRGB, sourceAlpha, destinationAlpha);
+}
+
+void OpenGLBackend::enable(GLenum capability) {
+	glEnable(capability);
+}
+
+void OpenGLBackend::viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glViewport(x, y, width, height);
+}
+
+void OpenGLBackend::clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glClearColor(red, green, blue, alpha);
+}
+
+void OpenGLBackend::clearDepth(GLdouble depth) {
+	glClearDepth(depth);
+}
+
+void OpenGLBackend::clear(GLbitfield mask) {
+	glClear(mask);
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include "GraphicsBackend.h"
+
+// forwards every call to OpenGL, needs a current context
+class OpenGLBackend : public GraphicsBackend
+{
+public:
+	// buffers
+	void genBuffers(GLsizei n, GLuint* buffers) override;
+	void deleteBuffers(GLsizei n, const GLuint* buffers) override;
+	void bindBuffer(GLenum target, GLuint buffer) override;
+	void bindBufferBase(GLenum target, GLuint index, GLuint buffer) override;
+	void bufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) override;
+	void bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) override;
+	void bufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags) override;
+	void* mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) override;
+	GLboolean unmapBuffer(GLenum target) override;
+	void copyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) override;
+
+	// vertex arrays
+	void genVertexArrays(GLsizei n, GLuint* arrays) override;
+	void deleteVertexArrays(GLsizei n, const GLuint* arrays) override;
+	void bindVertexArray(GLuint array) override;
+	void enableVertexAttribArray(GLuint index) override;
+	void vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer) override;
+	void vertexAttribDivisor(GLuint index, GLuint divisor) override;
+
+	// textures
+	void genTextures(GLsizei n, GLuint* textures) override;
+	void deleteTextures(GLsizei n, const GLuint* textures) override;
+	void activeTexture(GLenum texture) override;
+	void bindTexture(GLenum target, GLuint texture) override;
+	void texImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels) override;
+	void texImage3D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels) override;
+	void texSubImage3D(GLenum target, GLint level, GLint xOffset, GLint yOffset, GLint zOffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels) override;
+	void texParameteri(GLenum target, GLenum name, GLint param) override;
+	void textureParameteri(GLuint texture, GLenum name, GLint param) override;
+	void generateMipmap(GLenum target) override;
+
+	// framebuffers
+	void genFramebuffers(GLsizei n, GLuint* framebuffers) override;
+	void deleteFramebuffers(GLsizei n, const GLuint* framebuffers) override;
+	void bindFramebuffer(GLenum target, GLuint framebuffer) override;
+	void framebufferTexture2D(GLenum target, GLenum attachment, GLenum textureTarget, GLuint texture, GLint level) override;
+	GLenum checkFramebufferStatus(GLenum target) override;
+
+	// shaders
+	GLuint createShader(GLenum type) override;
+	void shaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length) override;
+	void compileShader(GLuint shader) override;
+	void getShaderiv(GLuint shader, GLenum name, GLint* params) override;
+	void getShaderInfoLog(GLuint shader, GLsizei bufferSize, GLsizei* length, GLchar* infoLog) override;
+	void deleteShader(GLuint shader) override;
+	GLuint createProgram() override;
+	void attachShader(GLuint program, GLuint shader) override;
+	void detachShader(GLuint program, GLuint shader) override;
+	void linkProgram(GLuint program) override;
+	void getProgramiv(GLuint program, GLenum name, GLint* params) override;
+	void bindAttribLocation(GLuint program, GLuint index, const GLchar* name) override;
+	void getActiveUniform(GLuint program, GLuint index, GLsizei bufferSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name) override;
+	GLint getUniformLocation(GLuint program, const GLchar* name) override;
+	GLuint getUniformBlockIndex(GLuint program, const GLchar* name) override;
+	void uniformBlockBinding(GLuint program, GLuint blockIndex, GLuint binding) override;
+	void useProgram(GLuint program) override;
+
+	// uniforms
+	void uniform1i(GLint location, GLint value) override;
+	void uniform1f(GLint location, GLfloat value) override;
+	void uniform2f(GLint location, GLfloat x, GLfloat y) override;
+
+	// draw
+	void drawArrays(GLenum mode, GLint first, GLsizei count) override;
+	void drawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint baseVertex) override;
+	void multiDrawArrays(GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawCount) override;
+	void multiDrawElementsBaseVertex(GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawCount, const GLint* baseVertex) override;
+	void drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount) override;
+	void drawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount, GLuint baseInstance) override;
+
+	// sync
+	GLsync fenceSync(GLenum condition, GLbitfield flags) override;
+	GLenum clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) override;
+	void deleteSync(GLsync sync) override;
+
+	// queries
+	void genQueries(GLsizei n, GLuint* queries) override;
+	void deleteQueries(GLsizei n, const GLuint* queries) override;
+	void beginQuery(GLenum target, GLuint query) override;
+	void endQuery(GLenum target) override;
+	void getQueryObjectiv(GLuint query, GLenum name, GLint* params) override;
+	void getQueryObjectui64v(GLuint query, GLenum name, GLuint64* params) override;
+
+	// frame
+	void blendFuncSeparate(GLenum sourceRGB, GLenum destinationRGB, GLenum sourceAlpha, GLenum destinationAlpha) override;
+	void enable(GLenum capability) override;
+	void viewport(GLint x, GLint y, GLsizei width, GLsizei height) override;
+	void clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) override;
+	void clearDepth(GLdouble depth) override;
+	void clear(GLbitfield mask) override;
+};
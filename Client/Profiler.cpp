@@ -0,0 +1,325 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+// gives the ring of an exiting thread to the next registered thread
+struct ProfileThreadHandle {
+	~ProfileThreadHandle() {
+		Profiler::releaseThread();
+	}
+};
+
+static thread_local ProfileThreadHandle threadHandle;
+
+std::vector<ProfileThread*> Profiler::threads;
+std::mutex Profiler::mutex;
+thread_local ProfileThread* Profiler::currentThread = nullptr;
+
+std::unordered_map<std::string, ZoneStats> Profiler::zoneStats;
+std::unordered_map<std::string, ZoneStats> Profiler::summary;
+std::unordered_map<std::string, ZoneStats> Profiler::lastFrame;
+int Profiler::frames = 0;
+bool Profiler::summaryReady = false;
+
+std::unordered_map<std::string, ValueStats> Profiler::valueStats;
+std::unordered_map<std::string, ValueStats> Profiler::valueSummary;
+std::vector<ProfileValue> Profiler::values;
+unsigned int Profiler::valueHead = 0;
+
+// threads
+void Profiler::setThreadName(const std::string& name) {
+	ProfileThread* thread = getThread();
+
+	std::lock_guard<std::mutex> lock(mutex);
+	thread->name = name;
+}
+
+// zones
+long long Profiler::now() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+long long Profiler::beginZone() {
+	ProfileThread* thread = currentThread;
+	if (thread == nullptr) {
+		thread = getThread();
+	}
+
+	thread->depth++;
+	return now();
+}
+
+void Profiler::endZone(const char* name, long long start) {
+	long long end = now();
+	ProfileThread* thread = currentThread;
+	thread->depth--;
+
+	addRecord(thread, name, start, end, thread->depth);
+}
+
+// tracks
+ProfileThread* Profiler::createTrack(const std::string& name, const char* category) {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// track stays active, so no thread takes its ring
+	ProfileThread* track = registerThread();
+	track->name = name;
+	track->category = category;
+
+	return track;
+}
+
+void Profiler::addRecord(ProfileThread* track, const char* name, long long start, long long end, int depth) {
+	// only the owner writes the ring, readers see the record once head is stored
+	unsigned int head = track->head.load(std::memory_order_relaxed);
+	ProfileRecord& record = track->records[head % PROFILER_RING_SIZE];
+	record.name = name;
+	record.start = start;
+	record.end = end;
+	record.depth = depth;
+	track->head.store(head + 1, std::memory_order_release);
+}
+
+// frame
+void Profiler::endFrame() {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	lastFrame.clear();
+	for (size_t i = 0; i < threads.size(); i++) {
+		collectRecords(threads[i]);
+	}
+
+	// stats are summed over a window, so the table does not change every frame
+	if (++frames >= PROFILER_SUMMARY_FRAMES) {
+		summary.swap(zoneStats);
+		zoneStats.clear();
+		valueSummary.swap(valueStats);
+		valueStats.clear();
+		frames = 0;
+		summaryReady = true;
+	}
+}
+
+void Profiler::printSummary() {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (!summaryReady) {
+		return;
+	}
+	summaryReady = false;
+
+	std::vector<std::pair<std::string, ZoneStats>> zones(summary.begin(), summary.end());
+	std::sort(zones.begin(), zones.end(), [](const std::pair<std::string, ZoneStats>& a, const std::pair<std::string, ZoneStats>& b) {
+		return a.second.totalTime > b.second.totalTime;
+	});
+
+	std::streamsize precision = std::cout.precision();
+	std::cout << std::left << std::setw(40) << "Zone" << std::right << std::setw(12) << "calls/frame" << std::setw(12) << "ms/frame" << std::setw(12) << "self ms" << std::setw(12) << "max ms" << std::endl;
+	for (size_t i = 0; i < zones.size(); i++) {
+		const ZoneStats& stats = zones[i].second;
+		std::string name = std::string(stats.depth * 2, ' ') + zones[i].first;
+
+		std::cout << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(3);
+		std::cout << std::setw(12) << (double)stats.calls / PROFILER_SUMMARY_FRAMES;
+		std::cout << std::setw(12) << stats.totalTime / NANOSECONDS_PER_MILISECOND / PROFILER_SUMMARY_FRAMES;
+		std::cout << std::setw(12) << stats.selfTime / NANOSECONDS_PER_MILISECOND / PROFILER_SUMMARY_FRAMES;
+		std::cout << std::setw(12) << stats.maxTime / NANOSECONDS_PER_MILISECOND << std::endl;
+	}
+
+	std::vector<std::pair<std::string, ValueStats>> valueLines(valueSummary.begin(), valueSummary.end());
+	std::sort(valueLines.begin(), valueLines.end(), [](const std::pair<std::string, ValueStats>& a, const std::pair<std::string, ValueStats>& b) {
+		return a.first < b.first;
+	});
+
+	if (!valueLines.empty()) {
+		std::cout << std::left << std::setw(40) << "Value" << std::right << std::setw(12) << "avg" << std::setw(12) << "max" << std::setw(12) << "last" << std::endl;
+	}
+	for (size_t i = 0; i < valueLines.size(); i++) {
+		const ValueStats& stats = valueLines[i].second;
+
+		std::cout << std::left << std::setw(40) << valueLines[i].first << std::right;
+		std::cout << std::setw(12) << stats.total / std::max(stats.samples, 1);
+		std::cout << std::setw(12) << stats.maxValue;
+		std::cout << std::setw(12) << stats.lastValue << std::endl;
+	}
+	std::cout.unsetf(std::ios::floatfield);
+	std::cout.precision(precision);
+}
+
+// values
+void Profiler::addValue(const char* name, long long value) {
+	long long time = now();
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (values.empty()) {
+		values.resize(PROFILER_VALUE_HISTORY);
+	}
+
+	ProfileValue& sample = values[valueHead % PROFILER_VALUE_HISTORY];
+	sample.name = name;
+	sample.time = time;
+	sample.value = value;
+	valueHead++;
+
+	ValueStats& stats = valueStats[name];
+	stats.samples++;
+	stats.total += value;
+	stats.maxValue = std::max(stats.maxValue, value);
+	stats.lastValue = value;
+}
+
+// export
+bool Profiler::exportChromeTrace(const std::string& filePath) {
+	std::ofstream file(filePath);
+	if (file.fail()) {
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// timestamps start at the oldest record, chrome://tracing expects microseconds
+	long long origin = -1;
+	for (size_t i = 0; i < threads.size(); i++) {
+		unsigned int head = threads[i]->head.load(std::memory_order_acquire);
+		unsigned int first = head > PROFILER_RING_SIZE ? head - PROFILER_RING_SIZE : 0;
+		if (head > first && (origin < 0 || threads[i]->records[first % PROFILER_RING_SIZE].start < origin)) {
+			origin = threads[i]->records[first % PROFILER_RING_SIZE].start;
+		}
+	}
+
+	unsigned int valueBegin = valueHead > PROFILER_VALUE_HISTORY ? valueHead - PROFILER_VALUE_HISTORY : 0;
+	if (valueHead > valueBegin && (origin < 0 || values[valueBegin % PROFILER_VALUE_HISTORY].time < origin)) {
+		origin = values[valueBegin % PROFILER_VALUE_HISTORY].time;
+	}
+
+	file << "{\"traceEvents\":[" << std::endl;
+	file << std::fixed << std::setprecision(3);
+
+	bool first = true;
+	for (size_t i = 0; i < threads.size(); i++) {
+		ProfileThread* thread = threads[i];
+
+		file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread->ID << ",\"args\":{\"name\":\"" << thread->name << "\"}}";
+		first = false;
+
+		unsigned int head = thread->head.load(std::memory_order_acquire);
+		unsigned int begin = head > PROFILER_RING_SIZE ? head - PROFILER_RING_SIZE : 0;
+
+		for (unsigned int j = begin; j < head; j++) {
+			const ProfileRecord& record = thread->records[j % PROFILER_RING_SIZE];
+			file << ",\n{\"name\":\"" << record.name << "\",\"cat\":\"" << thread->category << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread->ID;
+			file << ",\"ts\":" << (record.start - origin) / 1000.0 << ",\"dur\":" << (record.end - record.start) / 1000.0 << "}";
+		}
+	}
+
+	// values are counter tracks of the process
+	for (unsigned int i = valueBegin; i < valueHead; i++) {
+		const ProfileValue& sample = values[i % PROFILER_VALUE_HISTORY];
+		file << (first ? "" : ",\n") << "{\"name\":\"" << sample.name << "\",\"ph\":\"C\",\"pid\":0";
+		file << ",\"ts\":" << (sample.time - origin) / 1000.0 << ",\"args\":{\"value\":" << sample.value << "}}";
+		first = false;
+	}
+
+	file << std::endl << "]}" << std::endl;
+	return !file.fail();
+}
+
+// getters
+const std::unordered_map<std::string, ZoneStats>& Profiler::getSummary() {
+	return summary;
+}
+
+const std::unordered_map<std::string, ZoneStats>& Profiler::getLastFrame() {
+	return lastFrame;
+}
+
+const std::unordered_map<std::string, ValueStats>& Profiler::getValueSummary() {
+	return valueSummary;
+}
+
+// helper
+ProfileThread* Profiler::getThread() {
+	if (currentThread != nullptr) {
+		return currentThread;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// short lived threads such as path searches reuse rings of finished ones
+	for (size_t i = 0; i < threads.size(); i++) {
+		if (!threads[i]->active) {
+			currentThread = threads[i];
+			break;
+		}
+	}
+
+	if (currentThread == nullptr) {
+		currentThread = registerThread();
+	}
+
+	currentThread->active = true;
+	currentThread->depth = 0;
+	currentThread->name = "Thread " + std::to_string(currentThread->ID);
+	currentThread->category = "cpu";
+
+	// handle is constructed on first use, its destructor runs when the thread exits
+	(void)&threadHandle;
+
+	return currentThread;
+}
+
+ProfileThread* Profiler::registerThread() {
+	// must be called with the mutex locked
+	ProfileThread* thread = new ProfileThread();
+	thread->head = 0;
+	thread->active = true;
+	thread->readHead = 0;
+	thread->depth = 0;
+	thread->ID = (int)threads.size();
+	thread->category = "cpu";
+	threads.push_back(thread);
+
+	return thread;
+}
+
+void Profiler::releaseThread() {
+	if (currentThread != nullptr) {
+		currentThread->active = false;
+		currentThread = nullptr;
+	}
+}
+
+void Profiler::collectRecords(ProfileThread* thread) {
+	unsigned int head = thread->head.load(std::memory_order_acquire);
+
+	// records older than one ring were already overwritten
+	if (head - thread->readHead > PROFILER_RING_SIZE) {
+		thread->readHead = head - PROFILER_RING_SIZE;
+	}
+
+	for (; thread->readHead != head; thread->readHead++) {
+		const ProfileRecord& record = thread->records[thread->readHead % PROFILER_RING_SIZE];
+		long long time = record.end - record.start;
+		long long selfTime = time;
+
+		// zones are recorded when they close, so children of a zone are always read before it
+		if (record.depth < PROFILER_MAX_DEPTH) {
+			selfTime = time - thread->childTimes[record.depth + 1];
+			thread->childTimes[record.depth + 1] = 0;
+			thread->childTimes[record.depth] = thread->childTimes[record.depth] + time;
+		}
+
+		ZoneStats* stats[] = { &zoneStats[record.name], &lastFrame[record.name] };
+		for (ZoneStats* zone : stats) {
+			zone->calls++;
+			zone->totalTime = zone->totalTime + time;
+			zone->selfTime = zone->selfTime + selfTime;
+			zone->maxTime = std::max(zone->maxTime, time);
+			zone->depth = record.depth;
+		}
+	}
+}
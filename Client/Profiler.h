@@ -0,0 +1,154 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+// 0 compiles every zone out
+#define PROFILER_ENABLED 1
+// finished zones kept per thread, older ones are overwritten
+#define PROFILER_RING_SIZE 16384
+// frames summed into one summary table
+#define PROFILER_SUMMARY_FRAMES 120
+// deepest zone whose self time is known, deeper zones count to their parents only
+#define PROFILER_MAX_DEPTH 64
+// value samples kept for the trace, older ones are overwritten
+#define PROFILER_VALUE_HISTORY 16384
+#define NANOSECONDS_PER_MILISECOND 1000000.0
+
+// one finished zone, times are nanoseconds of the steady clock
+struct ProfileRecord {
+	const char* name;
+	long long start;
+	long long end;
+	int depth;
+};
+
+// Zones of one thread. Only the owner writes records, head is published with release, so the
+// profiler can read finished records without a lock. Threads which exit give their ring to the
+// next thread, records stay until they are overwritten.
+struct ProfileThread {
+	ProfileRecord records[PROFILER_RING_SIZE];
+	std::atomic<unsigned int> head;
+	std::atomic<bool> active;
+	unsigned int readHead;
+	long long childTimes[PROFILER_MAX_DEPTH + 1];
+	int depth;
+	int ID;
+	std::string name;
+	const char* category;
+};
+
+// one line of the summary table, times are for the whole summarized window,
+// self time excludes zones opened inside
+struct ZoneStats {
+	int calls;
+	long long totalTime;
+	long long selfTime;
+	long long maxTime;
+	int depth;
+};
+
+// one sample of a value reported by a subsystem, exported as a counter track
+struct ProfileValue {
+	const char* name;
+	long long time;
+	long long value;
+};
+
+// one line of the value table, summed over the summarized window
+struct ValueStats {
+	int samples;
+	long long total;
+	long long maxValue;
+	long long lastValue;
+};
+
+// Hierarchical CPU profiler. Zones are opened with PROFILE_ZONE / PROFILE_FUNCTION and closed at the
+// end of their scope, a zone costs two clock reads and one record store.
+class Profiler
+{
+private:
+	static std::vector<ProfileThread*> threads;
+	static std::mutex mutex;
+	static thread_local ProfileThread* currentThread;
+
+	// zones collected since the last summary and the last finished summary
+	static std::unordered_map<std::string, ZoneStats> zoneStats;
+	static std::unordered_map<std::string, ZoneStats> summary;
+	static std::unordered_map<std::string, ZoneStats> lastFrame;
+	static int frames;
+	static bool summaryReady;
+
+	// values reported since the last summary, the last finished summary and samples for the trace
+	static std::unordered_map<std::string, ValueStats> valueStats;
+	static std::unordered_map<std::string, ValueStats> valueSummary;
+	static std::vector<ProfileValue> values;
+	static unsigned int valueHead;
+public:
+	// threads
+	static void setThreadName(const std::string& name);
+
+	// zones
+	static long long now();
+	static long long beginZone();
+	static void endZone(const char* name, long long start);
+
+	// tracks which are not threads, records are added by their owner
+	static ProfileThread* createTrack(const std::string& name, const char* category);
+	static void addRecord(ProfileThread* track, const char* name, long long start, long long end, int depth);
+
+	// values, name must outlive the profiler
+	static void addValue(const char* name, long long value);
+
+	// frame
+	static void endFrame();
+	static void printSummary();
+
+	// export
+	static bool exportChromeTrace(const std::string& filePath);
+
+	// getters, valid on the thread which calls endFrame
+	static const std::unordered_map<std::string, ZoneStats>& getSummary();
+	static const std::unordered_map<std::string, ZoneStats>& getLastFrame();
+	static const std::unordered_map<std::string, ValueStats>& getValueSummary();
+private:
+	// helper
+	static ProfileThread* getThread();
+	static ProfileThread* registerThread();
+	static void releaseThread();
+	static void collectRecords(ProfileThread* thread);
+	friend struct ProfileThreadHandle;
+};
+
+// opens a zone in its constructor and closes it in its destructor
+class ProfileZone
+{
+private:
+	const char* name;
+	long long start;
+public:
+	ProfileZone(const char* name);
+	~ProfileZone();
+};
+
+inline ProfileZone::ProfileZone(const char* name) : name(name), start(Profiler::beginZone()) {
+
+}
+
+inline ProfileZone::~ProfileZone() {
+	Profiler::endZone(name, start);
+}
+
+#define PROFILE_CONCAT_LINE(name, line) name##line
+#define PROFILE_CONCAT(name, line) PROFILE_CONCAT_LINE(name, line)
+
+#if PROFILER_ENABLED
+// name must outlive the profiler, string literals only
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_ZONE(__FUNCTION__)
+#else
+#define PROFILE_ZONE(name)
+#define PROFILE_FUNCTION()
+#endif
@@ -0,0 +1,72 @@
+#include "QuadIndexBuffer.h"
+#include "GLState.h"
+#include "GraphicsBackend.h"
+#include <vector>
+
+QuadIndexBuffer::QuadIndexBuffer() : bufferID(0), capacity(0) {
+
+}
+
+// init
+void QuadIndexBuffer::init(int capacity) {
+	if (check()) {
+		GraphicsBackend::get().genBuffers(1, &bufferID);
+		this->capacity = capacity;
+		uploadIndices();
+	}
+}
+
+// bind
+void QuadIndexBuffer::bind() {
+	// element buffer binding is stored in currently bound vertex array
+	GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferID);
+}
+
+// setters
+void QuadIndexBuffer::reserve(int capacity) {
+	if (capacity > this->capacity) {
+		this->capacity = capacity;
+		uploadIndices();
+	}
+}
+
+// upload
+void QuadIndexBuffer::uploadIndices() {
+	std::vector<GLuint> indices;
+	indices.resize((size_t)capacity * QUAD_INDICES);
+
+	int index = 0;
+
+	for (int i = 0; i < capacity; i++) {
+		GLuint vertex = i * QUAD_VERTICES;
+
+		// top-right, top-left, bottom-left
+		indices[index++] = vertex;
+		indices[index++] = vertex + 1;
+		indices[index++] = vertex + 2;
+
+		// top-right, bottom-right, bottom-left
+		indices[index++] = vertex;
+		indices[index++] = vertex + 3;
+		indices[index++] = vertex + 2;
+	}
+
+	// use copy write binding so vertex array state stays untouched
+	GLState::bindBuffer(GL_COPY_WRITE_BUFFER, bufferID);
+	GraphicsBackend::get().bufferData(GL_COPY_WRITE_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
+	GLState::bindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+// getters
+GLuint QuadIndexBuffer::getBufferID() const {
+	return bufferID;
+}
+
+int QuadIndexBuffer::getCapacity() const {
+	return capacity;
+}
+
+// helper
+bool QuadIndexBuffer::check() {
+	return bufferID == 0;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <GL/glew.h>
+
+#define QUAD_VERTICES 4
+#define QUAD_INDICES 6
+
+// Static element buffer shared by every quad: quad i uses vertices [4i, 4i + 3].
+// Quads are drawn with base vertex, so one buffer serves every offset in the vertex buffer.
+class QuadIndexBuffer
+{
+private:
+	GLuint bufferID;
+	int capacity;
+public:
+	// constructors
+	QuadIndexBuffer();
+
+	// init
+	void init(int capacity);
+
+	// bind
+	void bind();
+
+	// setters
+	void reserve(int capacity);
+
+	// getters
+	GLuint getBufferID() const;
+	int getCapacity() const;
+private:
+	// upload
+	void uploadIndices();
+
+	// helper
+	bool check();
+};
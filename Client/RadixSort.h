@@ -0,0 +1,60 @@
+#pragma once
+#include <vector>
+#include <utility>
+
+#define RADIX_BITS 8
+#define RADIX_BUCKETS 256
+
+// Stable LSD radix sort of records by their unsigned integer member key, one byte per pass.
+// Passes where every key has the same byte are skipped, buffer is scratch memory kept by the caller.
+class RadixSort
+{
+public:
+	template<class T>
+	static void sort(std::vector<T>& records, std::vector<T>& buffer);
+};
+
+template<class T>
+inline void RadixSort::sort(std::vector<T>& records, std::vector<T>& buffer) {
+	size_t number = records.size();
+	if (number < 2) {
+		return;
+	}
+
+	buffer.resize(number);
+
+	T* source = records.data();
+	T* destination = buffer.data();
+
+	for (int shift = 0; shift < (int)sizeof(records[0].key) * 8; shift += RADIX_BITS) {
+		size_t counts[RADIX_BUCKETS] = {};
+
+		for (size_t i = 0; i < number; i++) {
+			counts[(source[i].key >> shift) & (RADIX_BUCKETS - 1)]++;
+		}
+
+		// every record falls in the same bucket, order would not change
+		if (counts[(source[0].key >> shift) & (RADIX_BUCKETS - 1)] == number) {
+			continue;
+		}
+
+		// bucket counts to first index of every bucket
+		size_t sum = 0;
+		for (int i = 0; i < RADIX_BUCKETS; i++) {
+			size_t count = counts[i];
+			counts[i] = sum;
+			sum = sum + count;
+		}
+
+		for (size_t i = 0; i < number; i++) {
+			destination[counts[(source[i].key >> shift) & (RADIX_BUCKETS - 1)]++] = source[i];
+		}
+
+		std::swap(source, destination);
+	}
+
+	// odd number of passes leaves sorted records in the buffer
+	if (source != records.data()) {
+		records.swap(buffer);
+	}
+}
@@ -0,0 +1,35 @@
+#include "RectInstance.h"
+#include <glm/packing.hpp>
+#include <glm/gtc/packing.hpp>
+
+RectInstance::RectInstance() : position(), size(0), color(), uv(), layer(0), padding(0) {
+
+}
+
+RectInstance::RectInstance(float x, float y, float width, float height, const glm::vec4& uv, Color color, int layer) : position(x, y), size(0), color(color), uv(), layer((GLushort)layer), padding(0) {
+	setSize(width, height);
+	setUV(uv);
+}
+
+void RectInstance::setPosition(float x, float y) {
+	position.setPosition(x, y);
+}
+
+void RectInstance::setSize(float width, float height) {
+	size = glm::packHalf2x16(glm::vec2(width, height));
+}
+
+void RectInstance::setColor(Color color) {
+	this->color = color;
+}
+
+void RectInstance::setUV(const glm::vec4& uv) {
+	this->uv[0] = glm::packUnorm1x16(uv.x);
+	this->uv[1] = glm::packUnorm1x16(uv.y);
+	this->uv[2] = glm::packUnorm1x16(uv.z);
+	this->uv[3] = glm::packUnorm1x16(uv.w);
+}
+
+void RectInstance::setLayer(int layer) {
+	this->layer = (GLushort)layer;
+}
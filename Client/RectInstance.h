@@ -0,0 +1,28 @@
+#pragma once
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include "Graphics.h"
+
+// per instance data of an axis aligned rectangle (28 bytes), the quad is expanded in vertex shader
+// size is stored as two half floats, UV rectangle (x, y, width, height) as normalized shorts
+// layer selects the image inside a texture array, position, size, color and UV already take 24 bytes
+// and can't lose precision, so layer adds 4 bytes with padding which keeps the stride 4 byte aligned
+class RectInstance {
+public:
+	Position position;
+	GLuint size;
+	Color color;
+	GLushort uv[4];
+	GLushort layer;
+	GLushort padding;
+public:
+	RectInstance();
+	RectInstance(float x, float y, float width, float height, const glm::vec4& uv, Color color, int layer = 0);
+
+	// setters
+	void setPosition(float x, float y);
+	void setSize(float width, float height);
+	void setColor(Color color);
+	void setUV(const glm::vec4& uv);
+	void setLayer(int layer);
+};
@@ -0,0 +1,283 @@
+#include "RenderContext.h"
+#include "Renderer.h"
+#include "GLSL_Line.h"
+#include "GLSL_Point.h"
+#include "GLSL_Rect.h"
+#include "GLSL_Square.h"
+#include "GLSL_Circle.h"
+#include "GLSL_Texture.h"
+#include "GLSL_Triangle.h"
+#include "Light.h"
+#include "AllocationTracker.h"
+
+RenderContext::RenderContext(Renderer* renderer, bool direct) : renderer(renderer), direct(direct), vertexStagings(), commands(), culledCount(0) {
+
+}
+
+// draw square
+void RenderContext::drawSquare(float x, float y, float width, float height, Color color) {
+	submitSquare(RenderPass::GEOMETRY, Square(x, y, width, height), color, NO_LIGHT);
+}
+
+void RenderContext::drawSquare(Square square, Color color) {
+	drawSquare(square.getX(), square.getY(), square.getWidth(), square.getHeight(), color);
+}
+
+void RenderContext::drawSquare(Square square) {
+	drawSquare(square.getX(), square.getY(), square.getWidth(), square.getHeight(), square.getColor());
+}
+
+// draw circle
+void RenderContext::drawCircle(float x, float y, float radius, int segments, Color color) {
+	if (isCulled(x - radius, y - radius, 2.0f * radius, 2.0f * radius)) {
+		return;
+	}
+	submit(RenderPass::GEOMETRY, GLSL_Circle(x, y, radius, segments, color, getVertexStream(VertexSource::GEOMETRY)), VertexSource::GEOMETRY);
+}
+
+void RenderContext::drawCircle(glm::vec2 center, float radius, int segments, Color color) {
+	drawCircle(center.x, center.y, radius, segments, color);
+}
+
+void RenderContext::drawCircle(Circle circle, Color color) {
+	drawCircle(circle.getX(), circle.getY(), circle.getRadius(), circle.getSegments(), color);
+}
+
+void RenderContext::drawCircle(Circle circle) {
+	drawCircle(circle.getX(), circle.getY(), circle.getRadius(), circle.getSegments(), circle.getColor());
+}
+
+// draw triangle
+void RenderContext::drawTriangle(glm::vec2 p1, glm::vec2 p2, glm::vec2 p3, Color color) {
+	if (isCulled(glm::min(p1, glm::min(p2, p3)), glm::max(p1, glm::max(p2, p3)))) {
+		return;
+	}
+	submit(RenderPass::GEOMETRY, GLSL_Triangle(p1, p2, p3, color, getVertexStream(VertexSource::GEOMETRY)), VertexSource::GEOMETRY);
+}
+
+void RenderContext::drawTriangle(Triangle triangle, Color color) {
+	drawTriangle(triangle.getP1(), triangle.getP2(), triangle.getP3(), color);
+}
+
+void RenderContext::drawTriangle(Triangle triangle) {
+	drawTriangle(triangle.getP1(), triangle.getP2(), triangle.getP3(), triangle.getColor());
+}
+
+// draw line
+void RenderContext::drawLine(glm::vec2 p1, glm::vec2 p2, Color color) {
+	if (isCulled(glm::min(p1, p2), glm::max(p1, p2))) {
+		return;
+	}
+	submit(RenderPass::GEOMETRY, GLSL_Line(p1, p2, color, getVertexStream(VertexSource::GEOMETRY)), VertexSource::GEOMETRY);
+}
+
+void RenderContext::drawLine(float x, float y, float x1, float y1, Color color) {
+	drawLine(glm::vec2(x, y), glm::vec2(x1, y1), color);
+}
+
+void RenderContext::drawLine(Line line, Color color) {
+	drawLine(line.getP1(), line.getP2(), color);
+}
+
+void RenderContext::drawLine(Line line) {
+	drawLine(line.getP1(), line.getP2(), line.getColor());
+}
+
+// draw point
+void RenderContext::drawPoint(glm::vec2 p, Color color) {
+	if (isCulled(p, p)) {
+		return;
+	}
+	submit(RenderPass::GEOMETRY, GLSL_Point(p, color, getVertexStream(VertexSource::GEOMETRY)), VertexSource::GEOMETRY);
+}
+
+void RenderContext::drawPoint(float x, float y, Color color) {
+	drawPoint(glm::vec2(x, y), color);
+}
+
+void RenderContext::drawPoint(Point point, Color color) {
+	drawPoint(point.getX(), point.getY(), color);
+}
+
+void RenderContext::drawPoint(Point point) {
+	drawPoint(point.getX(), point.getY(), point.getColor());
+}
+
+// draw texture
+void RenderContext::drawTexture(float x, float y, float width, float height, GLTexture texture) {
+	drawTexture(x, y, width, height, glm::vec4(0.0f, 0.0f, 1.0f, 1.0f), texture);
+}
+
+void RenderContext::drawTexture(Square square, GLTexture texture) {
+	drawTexture(square.getX(), square.getY(), square.getWidth(), square.getHeight(), texture);
+}
+
+void RenderContext::drawTexture(float x, float y, float width, float height, TextureAtlas textureAtlas, int textureIndex) {
+	drawTexture(x, y, width, height, textureAtlas.getUV(textureIndex), textureAtlas.getTexture());
+}
+
+void RenderContext::drawTexture(float x, float y, float width, float height, const glm::vec4& uv, const GLTexture& texture) {
+	submitTexture(RenderPass::TEXTURE, x, y, width, height, uv, texture, NO_LIGHT);
+}
+
+void RenderContext::drawTexture(Square square, TextureAtlas textureAtlas, int textureIndex) {
+	drawTexture(square.getX(), square.getY(), square.getWidth(), square.getHeight(), textureAtlas, textureIndex);
+}
+
+// draw light
+void RenderContext::drawLight(Light* light) {
+	int lightIndex = renderer->getLightIndex(light);
+	if (lightIndex < 0) {
+		return;
+	}
+
+	Square square = light->getBounds();
+	if (isCulled(square.getX(), square.getY(), square.getWidth(), square.getHeight())) {
+		return;
+	}
+
+	// baked lights are one textured quad, stretched when the radius is animated
+	auto it = renderer->lightmaps.find(light->getID());
+	if (it != renderer->lightmaps.end()) {
+		GLSL_Texture quad(square.getX(), square.getY(), square.getWidth(), square.getHeight(), glm::vec4(0.0f, 0.0f, 1.0f, 1.0f), it->second, getVertexStream(VertexSource::TEXTURE));
+		submit(RenderPass::LIGHTMAP, quad, VertexSource::TEXTURE, quad.getTextureID(), LightSlot::fromIndex(lightIndex));
+		return;
+	}
+
+	submitSquare(RenderPass::LIGHT, square, square.getColor(), LightSlot::fromIndex(lightIndex));
+}
+
+// draw light mask
+void RenderContext::drawLightMask(glm::vec2 p1, glm::vec2 p2, glm::vec2 p3, Color color) {
+	if (isCulled(glm::min(p1, glm::min(p2, p3)), glm::max(p1, glm::max(p2, p3)))) {
+		return;
+	}
+	submit(RenderPass::LIGHT_MASK, GLSL_Triangle(p1, p2, p3, color, getVertexStream(VertexSource::GEOMETRY)), VertexSource::GEOMETRY);
+}
+
+// draw visible objects, shadow mode only
+void RenderContext::drawSquare(Light* light, Square square, Color color) {
+	int lightIndex = renderer->getLightIndex(light);
+	if (lightIndex < 0 || renderer->mode != RenderMode::SHADOWS) {
+		return;
+	}
+
+	submitSquare(RenderPass::VISIBLE, square, color, LightSlot::fromIndex(lightIndex));
+}
+
+void RenderContext::drawTexture(Light* light, Square square, GLTexture texture) {
+	int lightIndex = renderer->getLightIndex(light);
+	if (lightIndex < 0 || renderer->mode != RenderMode::SHADOWS) {
+		return;
+	}
+
+	glm::vec4 uv(0.0f, 0.0f, 1.0f, 1.0f);
+	submitTexture(RenderPass::VISIBLE_TEXTURE, square.getX(), square.getY(), square.getWidth(), square.getHeight(), uv, texture, LightSlot::fromIndex(lightIndex));
+}
+
+// draw objects visible from any light
+void RenderContext::drawVisibleSquare(Square square, Color color) {
+	if (renderer->mode == RenderMode::MULTI_SHADOWS) {
+		submitSquare(RenderPass::VISIBLE, square, color, ALL_LIGHTS);
+	}
+}
+
+void RenderContext::drawVisibleTexture(Square square, GLTexture texture) {
+	if (renderer->mode == RenderMode::MULTI_SHADOWS) {
+		glm::vec4 uv(0.0f, 0.0f, 1.0f, 1.0f);
+		submitTexture(RenderPass::VISIBLE_TEXTURE, square.getX(), square.getY(), square.getWidth(), square.getHeight(), uv, texture, NO_LIGHT);
+	}
+}
+
+// submit
+void RenderContext::submit(RenderPass pass, const GLSL_Object& object, VertexSource source, GLuint textureID, int light) {
+	if (!renderer->isPassEnabled(pass)) {
+		return;
+	}
+
+	RenderProgram program = renderer->getProgram(pass, source, light);
+	BlendMode blend = renderer->getBlend(pass);
+
+	MEMORY_SCOPE(MemoryTag::RENDERER);
+	unsigned long long key = RenderKey::create((int)pass, (int)blend, (int)program, light, textureID, 0);
+	getQueue().add(key, RenderCommand(object, textureID, pass, source, program, blend, light));
+}
+
+void RenderContext::submitSquare(RenderPass pass, Square square, Color color, int light) {
+	if (isCulled(square.getX(), square.getY(), square.getWidth(), square.getHeight())) {
+		return;
+	}
+
+	// squares and textures are either instanced rectangles or quads, depending on instancing
+	if (renderer->instancing) {
+		submit(pass, GLSL_Rect(square.getX(), square.getY(), square.getWidth(), square.getHeight(), color, getVertexStream(VertexSource::RECT)), VertexSource::RECT, 0, light);
+	}
+	else {
+		submit(pass, GLSL_Square(square.getX(), square.getY(), square.getWidth(), square.getHeight(), color, getVertexStream(VertexSource::GEOMETRY)), VertexSource::GEOMETRY, 0, light);
+	}
+}
+
+void RenderContext::submitTexture(RenderPass pass, float x, float y, float width, float height, const glm::vec4& uv, const GLTexture& texture, int light) {
+	if (isCulled(x, y, width, height)) {
+		return;
+	}
+
+	// textures which are not in a texture array can't be instanced, instanced only textures have nothing else to draw with
+	if (texture.arrayID != 0 && (renderer->instancing || texture.ID == 0)) {
+		GLSL_Rect rect(x, y, width, height, uv, texture, getVertexStream(VertexSource::RECT));
+		submit(pass, rect, VertexSource::RECT, rect.getTextureID(), light);
+	}
+	else {
+		GLSL_Texture quad(x, y, width, height, uv, texture, getVertexStream(VertexSource::TEXTURE));
+		submit(pass, quad, VertexSource::TEXTURE, quad.getTextureID(), light);
+	}
+}
+
+bool RenderContext::isCulled(float x, float y, float width, float height) {
+	// objects are culled before their vertices are written, so nothing off screen is uploaded
+	if (!renderer->culling || (x <= renderer->viewMax.x && y <= renderer->viewMax.y && x + width >= renderer->viewMin.x && y + height >= renderer->viewMin.y)) {
+		return false;
+	}
+
+	culledCount++;
+	return true;
+}
+
+bool RenderContext::isCulled(glm::vec2 min, glm::vec2 max) {
+	return isCulled(min.x, min.y, max.x - min.x, max.y - min.y);
+}
+
+// reset
+void RenderContext::reset() {
+	culledCount = 0;
+
+	if (direct) {
+		return;
+	}
+
+	// staging streams take the layout of the buffers they are merged into
+	for (int i = 0; i < 3; i++) {
+		vertexStagings[i].init(renderer->vertexFormats[i].getStride());
+	}
+	commands.clear();
+}
+
+// getters
+int RenderContext::getCulledCount() const {
+	return culledCount;
+}
+
+// helper
+VertexStream& RenderContext::getVertexStream(VertexSource source) {
+	if (direct) {
+		return renderer->vertexBuffers[(int)source];
+	}
+	return vertexStagings[(int)source];
+}
+
+RenderQueue<RenderCommand>& RenderContext::getQueue() {
+	if (direct) {
+		return renderer->renderQueue;
+	}
+	return commands;
+}
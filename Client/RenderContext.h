@@ -0,0 +1,196 @@
+#pragma once
+#include "Line.h"
+#include "Point.h"
+#include "Square.h"
+#include "Circle.h"
+#include "Triangle.h"
+#include "GLSL_Object.h"
+#include "GLTexture.h"
+#include "TextureAtlas.h"
+#include "VertexStream.h"
+#include "VertexStaging.h"
+#include "RenderQueue.h"
+#include <glm/glm.hpp>
+
+class Light;
+class Renderer;
+
+enum class RenderMode {
+	DEFAULT,
+	SHADOWS,
+	MULTI_SHADOWS
+};
+
+// passes are drawn in this order, DEFAULT mode draws GEOMETRY, STATIC and TEXTURE only
+enum class RenderPass {
+	LIGHT_MASK,
+	LIGHTMAP,
+	GEOMETRY,
+	VISIBLE,
+	LIGHT,
+	STATIC,
+	TEXTURE,
+	VISIBLE_TEXTURE
+};
+
+enum class BlendMode {
+	NONE,
+	LIGHT_MASK,
+	ALPHA_MASK,
+	LIGHT,
+	ALPHA,
+	ADDITIVE
+};
+
+// must fit into RENDER_KEY_PROGRAM_BITS
+enum class RenderProgram {
+	GEOMETRY,
+	TEXTURE,
+	VISION_GEOMETRY,
+	VISION_TEXTURE,
+	INSTANCE_GEOMETRY,
+	INSTANCE_TEXTURE,
+	VISION_INSTANCE_GEOMETRY,
+	VISION_INSTANCE_TEXTURE,
+	MULTI_VISION_GEOMETRY,
+	MULTI_VISION_TEXTURE,
+	MULTI_VISION_INSTANCE_GEOMETRY,
+	MULTI_VISION_INSTANCE_TEXTURE,
+	LIGHTMAP,
+	STATIC_GEOMETRY,
+	VISION_STATIC_GEOMETRY,
+	MULTI_VISION_STATIC_GEOMETRY
+};
+
+// vertex buffer the object was written to, static geometry has its own buffers
+enum class VertexSource {
+	GEOMETRY,
+	TEXTURE,
+	RECT,
+	STATIC
+};
+
+// light slot of a command, light with index i of the renderer is stored in slot FIRST_LIGHT + i.
+// The key keeps RENDER_KEY_LIGHT_BITS (8) bits of the slot, so from 256 on slots wrap onto NO_LIGHT
+// and ALL_LIGHTS in the key and commands of different lights are no longer grouped apart.
+#define NO_LIGHT 0
+#define ALL_LIGHTS 1
+#define FIRST_LIGHT 2
+
+// converts between index of a light in the renderer and its light slot
+class LightSlot
+{
+public:
+	static int fromIndex(int lightIndex);
+	static int toIndex(int light);
+};
+
+inline int LightSlot::fromIndex(int lightIndex) {
+	return FIRST_LIGHT + lightIndex;
+}
+
+inline int LightSlot::toIndex(int light) {
+	return light - FIRST_LIGHT;
+}
+
+// one draw submission, state is everything the key was built from
+struct RenderCommand {
+	GLSL_Object object;
+	GLuint textureID;
+	RenderPass pass;
+	VertexSource source;
+	RenderProgram program;
+	BlendMode blend;
+	int light;
+
+	RenderCommand(const GLSL_Object& object, GLuint textureID, RenderPass pass, VertexSource source, RenderProgram program, BlendMode blend, int light) : object(object), textureID(textureID), pass(pass), source(source), program(program), blend(blend), light(light) {}
+};
+
+// Records draw calls of one thread. Worker contexts write vertices to their own staging
+// streams and queue, Renderer::end merges them into the frame. Renderer itself is the direct
+// context, it writes straight into the mapped buffers. Contexts only read renderer settings,
+// so they may record in parallel between begin and end.
+class RenderContext
+{
+	friend class Renderer;
+protected:
+	Renderer* renderer;
+	bool direct;
+
+	// 0 - geometry, 1 - texture, 2 - rect instances, unused by direct context
+	VertexStaging vertexStagings[3];
+	RenderQueue<RenderCommand> commands;
+
+	int culledCount;
+public:
+	// constructors
+	RenderContext(Renderer* renderer, bool direct = false);
+
+	// ========================== < NON-LIGHT DRAWING > ========================== //
+
+	// draw square
+	void drawSquare(float x, float y, float width, float height, Color color = WHITE);
+	void drawSquare(Square square, Color color);
+	void drawSquare(Square square);
+
+	// draw circle
+	void drawCircle(glm::vec2 center, float radius, int segments = SEGMENT_NUMBER, Color color = WHITE);
+	void drawCircle(float x, float y, float radius, int segments = SEGMENT_NUMBER, Color color = WHITE);
+	void drawCircle(Circle circle, Color color);
+	void drawCircle(Circle circle);
+
+	// draw triangle
+	void drawTriangle(glm::vec2 p1, glm::vec2 p2, glm::vec2 p3, Color color = WHITE);
+	void drawTriangle(Triangle triangle, Color color);
+	void drawTriangle(Triangle triangle);
+
+	// draw line
+	void drawLine(glm::vec2 p1, glm::vec2 p2, Color color = WHITE);
+	void drawLine(float x, float y, float x1, float y1, Color color = WHITE);
+	void drawLine(Line line, Color color);
+	void drawLine(Line line);
+
+	// draw point
+	void drawPoint(glm::vec2 p, Color color = WHITE);
+	void drawPoint(float x, float y, Color color = WHITE);
+	void drawPoint(Point point, Color color);
+	void drawPoint(Point point);
+	
+	// draw texture
+	void drawTexture(float x, float y, float width, float height, GLTexture texture);
+	void drawTexture(float x, float y, float width, float height, TextureAtlas textureAtlas, int textureIndex);
+	void drawTexture(Square square, GLTexture texture);
+	void drawTexture(Square square, TextureAtlas textureAtlas, int textureIndex);
+	void drawTexture(float x, float y, float width, float height, const glm::vec4& uv, const GLTexture& texture);
+
+	// ========================== < LIGHT DRAWING > ========================== //
+
+	// draw light mask
+	void drawLightMask(glm::vec2 p1, glm::vec2 p2, glm::vec2 p3, Color color = WHITE);
+	void drawLight(Light* light);
+	void drawSquare(Light* light, Square square, Color color);
+	void drawTexture(Light* light, Square square, GLTexture texture);
+
+	// draw objects visible from any light, multi shadow mode only
+	void drawVisibleSquare(Square square, Color color);
+	void drawVisibleTexture(Square square, GLTexture texture);
+
+	// getters
+	int getCulledCount() const;
+protected:
+	// submit
+	void submit(RenderPass pass, const GLSL_Object& object, VertexSource source, GLuint textureID = 0, int light = NO_LIGHT);
+	void submitSquare(RenderPass pass, Square square, Color color, int light);
+	void submitTexture(RenderPass pass, float x, float y, float width, float height, const glm::vec4& uv, const GLTexture& texture, int light);
+
+	// culling
+	bool isCulled(float x, float y, float width, float height);
+	bool isCulled(glm::vec2 min, glm::vec2 max);
+
+	// reset
+	void reset();
+
+	// helper
+	VertexStream& getVertexStream(VertexSource source);
+	RenderQueue<RenderCommand>& getQueue();
+};
@@ -0,0 +1,33 @@
+#include "RenderQueue.h"
+#include <cstring>
+
+unsigned long long RenderKey::create(int pass, int blend, int program, int light, GLuint texture, GLuint depth) {
+	unsigned long long key = 0;
+
+	// every field is cut to its width, so it can't overflow into the field above it
+	key = (key << RENDER_KEY_PASS_BITS) | ((unsigned long long)pass & ((1ULL << RENDER_KEY_PASS_BITS) - 1));
+	key = (key << RENDER_KEY_BLEND_BITS) | ((unsigned long long)blend & ((1ULL << RENDER_KEY_BLEND_BITS) - 1));
+	key = (key << RENDER_KEY_PROGRAM_BITS) | ((unsigned long long)program & ((1ULL << RENDER_KEY_PROGRAM_BITS) - 1));
+	key = (key << RENDER_KEY_LIGHT_BITS) | ((unsigned long long)light & ((1ULL << RENDER_KEY_LIGHT_BITS) - 1));
+	key = (key << RENDER_KEY_TEXTURE_BITS) | ((unsigned long long)texture & ((1ULL << RENDER_KEY_TEXTURE_BITS) - 1));
+	key = (key << RENDER_KEY_DEPTH_BITS) | ((unsigned long long)depth & ((1ULL << RENDER_KEY_DEPTH_BITS) - 1));
+
+	return key;
+}
+
+GLuint RenderKey::createDepth(float depth) {
+	// IEEE float bits are made to compare like unsigned integers: negative values are
+	// flipped completely, positive ones only get the sign bit set
+	GLuint bits;
+	std::memcpy(&bits, &depth, sizeof(bits));
+
+	if (bits & 0x80000000) {
+		bits = ~bits;
+	}
+	else {
+		bits = bits | 0x80000000;
+	}
+
+	// only the most significant bits fit into the key
+	return bits >> (32 - RENDER_KEY_DEPTH_BITS);
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <GL/glew.h>
+#include <vector>
+#include "RadixSort.h"
+
+// bits of every field of a render key, from the most significant one:
+// pass | blend | program | light | texture | depth
+#define RENDER_KEY_PASS_BITS 4
+#define RENDER_KEY_BLEND_BITS 4
+#define RENDER_KEY_PROGRAM_BITS 4
+#define RENDER_KEY_LIGHT_BITS 8
+#define RENDER_KEY_TEXTURE_BITS 20
+#define RENDER_KEY_DEPTH_BITS 24
+
+// 64 bit sort key, submissions are drawn in the order of their keys
+class RenderKey
+{
+public:
+	static unsigned long long create(int pass, int blend, int program, int light, GLuint texture, GLuint depth);
+	static GLuint createDepth(float depth);
+};
+
+// sort record, index points to the command in submission order
+struct RenderRecord {
+	unsigned long long key;
+	GLuint index;
+};
+
+// Commands are added in any order and sorted once per frame by their keys. Sort is stable,
+// so commands with the same key keep the order they were added in.
+template <class T>
+class RenderQueue
+{
+private:
+	std::vector<T> commands;
+	std::vector<RenderRecord> records;
+	std::vector<RenderRecord> sortBuffer;
+public:
+	// add
+	void add(unsigned long long key, const T& command);
+
+	// sort / clear
+	void sort();
+	void clear();
+
+	// getters
+	const T& get(int index) const;
+	unsigned long long getKey(int index) const;
+	int getSize() const;
+	bool isEmpty() const;
+};
+
+// add
+template<class T>
+inline void RenderQueue<T>::add(unsigned long long key, const T& command) {
+	RenderRecord record;
+	record.key = key;
+	record.index = (GLuint)commands.size();
+
+	commands.push_back(command);
+	records.push_back(record);
+}
+
+// sort / clear
+template<class T>
+inline void RenderQueue<T>::sort() {
+	RadixSort::sort(records, sortBuffer);
+}
+
+template<class T>
+inline void RenderQueue<T>::clear() {
+	// memory is kept for the next frame
+	commands.clear();
+	records.clear();
+}
+
+// getters
+template<class T>
+inline const T& RenderQueue<T>::get(int index) const {
+	return commands[records[index].index];
+}
+
+template<class T>
+inline unsigned long long RenderQueue<T>::getKey(int index) const {
+	return records[index].key;
+}
+
+template<class T>
+inline int RenderQueue<T>::getSize() const {
+	return (int)records.size();
+}
+
+template<class T>
+inline bool RenderQueue<T>::isEmpty() const {
+	return records.empty();
+}
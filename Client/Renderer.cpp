@@ -1,21 +1,29 @@
 #include "Renderer.h"
-#include "GLSL_Line.h"
-#include "GLSL_Point.h"
-#include "GLSL_Square.h"
-#include "GLSL_Circle.h"
-#include "GLSL_Triangle.h"
+#include "GLState.h"
+#include "ImageLoader.h"
+#include "RectInstance.h"
 #include "Light.h"
+#include "Collision.h"
 #include "EngineConfig.h"
 #include "Utils.h"
+#include "GraphicsBackend.h"
+#include "Profiler.h"
+#include "Counters.h"
+#include "AllocationTracker.h"
 #include <TTF/SDL_ttf.h>
 #include <GL/glew.h>
 #include <iostream>
+#include <cstring>
 
-Renderer::Renderer() : vertexArrays(), vertexBuffers(), offset(0), textureOffset(0), mode(RenderMode::DEFAULT) {
+static Counter renderedVertices("Renderer vertices");
+static Counter renderedInstances("Renderer instances");
+static Counter drawCalls("Renderer draw calls");
+
+Renderer::Renderer() : RenderContext(this, true), contexts(), vertexArrays(), vertexFormats(), vertexBuffers(), camera(nullptr), mode(RenderMode::DEFAULT), instancing(true), culling(true), lightAccumulation(true), accumulating(false), gpuTiming(true), currentProgram(RenderProgram::GEOMETRY), currentSource(VertexSource::GEOMETRY), currentBlend(BlendMode::NONE), currentLight(NO_LIGHT), currentTexture(0), stateBound(false), viewMin(0.0f), viewMax(0.0f), objectCount(0), drawCallCount(0), stateChanges() {
 
 }
 
-Renderer::Renderer(Camera2D& camera) : vertexArrays(), vertexBuffers(), offset(0), textureOffset(0), mode(RenderMode::DEFAULT) {
+Renderer::Renderer(Camera2D& camera) : RenderContext(this, true), contexts(), vertexArrays(), vertexFormats(), vertexBuffers(), camera(&camera), mode(RenderMode::DEFAULT), instancing(true), culling(true), lightAccumulation(true), accumulating(false), gpuTiming(true), currentProgram(RenderProgram::GEOMETRY), currentSource(VertexSource::GEOMETRY), currentBlend(BlendMode::NONE), currentLight(NO_LIGHT), currentTexture(0), stateBound(false), viewMin(0.0f), viewMax(0.0f), objectCount(0), drawCallCount(0), stateChanges() {
 	init();
 }
 
@@ -25,390 +33,761 @@ void Renderer::init() {
 
 void Renderer::init(Camera2D& camera) {
 	if (check()) {
+		this->camera = &camera;
 		initVertexArray();
-		initShaderProgram(camera);
+		initShaderProgram();
+		lightBuffer.init();
+		cameraBuffer.init(camera);
+		lightAccumulationBuffer.init(camera.getScreenWidth(), camera.getScreenHeight());
+		gpuTimer.init();
 	}
 }
 
 void Renderer::initVertexArray() {
-	glGenVertexArrays(2, &vertexArrays[0]);
-	glGenBuffers(2, &vertexBuffers[0]);
+	GraphicsBackend::get().genVertexArrays(3, &vertexArrays[0]);
 
-	// bind shaderProgram buffer
-	glBindVertexArray(vertexArrays[0]);
-	glBindBuffer(GL_ARRAY_BUFFER, vertexBuffers[0]);
+	// every buffer has the smallest layout its programs read, geometry has no UV
+	vertexFormats[0] = VertexFormat::createColorVertex();
+	vertexFormats[1] = VertexFormat::createVertex();
 
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+	// one record per rectangle instead of four vertices
+	vertexFormats[2] = VertexFormat::createRectInstance();
 
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+	// streaming buffers, vertices are written straight into mapped memory
+	vertexBuffers[0].init(vertexFormats[0].getStride());
+	vertexBuffers[1].init(vertexFormats[1].getStride());
+	vertexBuffers[2].init(vertexFormats[2].getStride(), RING_BUFFER_CAPACITY / QUAD_VERTICES);
 
-	glBindVertexArray(0);
+	// squares and textures are drawn as indexed quads
+	quadIndexBuffer.init(RING_BUFFER_CAPACITY / QUAD_VERTICES);
 
-	// bind textureProgram buffer
-	glBindVertexArray(vertexArrays[1]);
-	glBindBuffer(GL_ARRAY_BUFFER, vertexBuffers[1]);
+	initVertexAttributes();
+}
 
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+void Renderer::initVertexAttributes() {
+	for (int i = 0; i < 3; i++) {
+		GLState::bindVertexArray(vertexArrays[i]);
+		GLState::bindBuffer(GL_ARRAY_BUFFER, vertexBuffers[i].getBufferID());
 
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+		vertexFormats[i].enableAttributes();
+		vertexFormats[i].bindAttributes();
 
-	glEnableVertexAttribArray(2);
-	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, uv));
+		// instances expand their quad in vertex shader, vertices index one shared quad buffer
+		if (vertexFormats[i].getDivisor() == 0) {
+			quadIndexBuffer.bind();
+		}
 
-	glBindVertexArray(0);
+		GLState::bindVertexArray(0);
+	}
 }
 
-void Renderer::initShaderProgram(Camera2D& camera) {
+void Renderer::initShaderProgram() {
 	// the order of attributes must be the same as order used in shaders
 	// non shadow shaders
-	geometryProgram.initShaders(camera, GEOMETRY_VERTEX_PATH, GEOMETRY_FRAGMENT_PATH);
+	geometryProgram.init(GEOMETRY_VERTEX_PATH, GEOMETRY_FRAGMENT_PATH);
 	geometryProgram.addAttribute("vertexPosition");
 	geometryProgram.addAttribute("vertexColor");
 	geometryProgram.linkShaders();
 
-	textureProgram.initShaders(camera, TEXTURE_VERTEX_PATH, TEXTURE_FRAGMENT_PATH);
+	textureProgram.init(TEXTURE_VERTEX_PATH, TEXTURE_FRAGMENT_PATH);
 	textureProgram.addAttribute("vertexPosition");
 	textureProgram.addAttribute("vertexColor");
 	textureProgram.addAttribute("vertexUV");
 	textureProgram.linkShaders();
 
 	// shadow programs
-	visionGeometryProgram.initShaders(camera, VISION_GEOMETRY_VERTEX_PATH, VISION_GEOMETRY_FRAGMENT_PATH);
+	visionGeometryProgram.init(VISION_GEOMETRY_VERTEX_PATH, VISION_GEOMETRY_FRAGMENT_PATH);
 	visionGeometryProgram.addAttribute("vertexPosition");
 	visionGeometryProgram.addAttribute("vertexColor");
 	visionGeometryProgram.linkShaders();
 
-	visionTextureProgram.initShaders(camera, VISION_TEXTURE_VERTEX_PATH, VISION_TEXTURE_FRAGMENT_PATH);
+	visionTextureProgram.init(VISION_TEXTURE_VERTEX_PATH, VISION_TEXTURE_FRAGMENT_PATH);
 	visionTextureProgram.addAttribute("vertexPosition");
 	visionTextureProgram.addAttribute("vertexColor");
 	visionTextureProgram.addAttribute("vertexUV");
 	visionTextureProgram.linkShaders();
+
+	// instanced programs, quad corners are generated in vertex shader
+	instanceGeometryProgram.init(INSTANCE_VERTEX_PATH, GEOMETRY_FRAGMENT_PATH);
+	instanceTextureProgram.init(INSTANCE_VERTEX_PATH, TEXTURE_ARRAY_FRAGMENT_PATH);
+	visionInstanceGeometryProgram.init(INSTANCE_VERTEX_PATH, VISION_GEOMETRY_FRAGMENT_PATH);
+	visionInstanceTextureProgram.init(INSTANCE_VERTEX_PATH, VISION_TEXTURE_ARRAY_FRAGMENT_PATH);
+
+	// multi shadow programs, every light is read from light buffer
+	multiVisionGeometryProgram.init(MULTI_VISION_GEOMETRY_VERTEX_PATH, MULTI_VISION_GEOMETRY_FRAGMENT_PATH);
+	multiVisionGeometryProgram.addAttribute("vertexPosition");
+	multiVisionGeometryProgram.addAttribute("vertexColor");
+	multiVisionGeometryProgram.linkShaders();
+	multiVisionGeometryProgram.bindUniformBlock(LIGHT_BLOCK_NAME, LIGHT_BLOCK_BINDING);
+
+	multiVisionTextureProgram.init(MULTI_VISION_TEXTURE_VERTEX_PATH, MULTI_VISION_TEXTURE_FRAGMENT_PATH);
+	multiVisionTextureProgram.addAttribute("vertexPosition");
+	multiVisionTextureProgram.addAttribute("vertexColor");
+	multiVisionTextureProgram.addAttribute("vertexUV");
+	multiVisionTextureProgram.linkShaders();
+
+	multiVisionInstanceGeometryProgram.init(INSTANCE_VERTEX_PATH, MULTI_VISION_GEOMETRY_FRAGMENT_PATH);
+	multiVisionInstanceTextureProgram.init(INSTANCE_VERTEX_PATH, MULTI_VISION_TEXTURE_ARRAY_FRAGMENT_PATH);
+
+	ShaderProgram* instancePrograms[] = { &instanceGeometryProgram, &instanceTextureProgram, &visionInstanceGeometryProgram, &visionInstanceTextureProgram, &multiVisionInstanceGeometryProgram, &multiVisionInstanceTextureProgram };
+
+	for (ShaderProgram* program : instancePrograms) {
+		program->addAttribute("instancePosition");
+		program->addAttribute("instanceSize");
+		program->addAttribute("instanceColor");
+		program->addAttribute("instanceUV");
+		program->addAttribute("instanceLayer");
+		program->linkShaders();
+	}
+
+	multiVisionInstanceGeometryProgram.bindUniformBlock(LIGHT_BLOCK_NAME, LIGHT_BLOCK_BINDING);
+
+	// baked light program
+	lightmapProgram.init(TEXTURE_VERTEX_PATH, LIGHTMAP_FRAGMENT_PATH);
+	lightmapProgram.addAttribute("vertexPosition");
+	lightmapProgram.addAttribute("vertexColor");
+	lightmapProgram.addAttribute("vertexUV");
+	lightmapProgram.linkShaders();
+
+	// static geometry programs
+	staticGeometryProgram.init(STATIC_GEOMETRY_VERTEX_PATH, GEOMETRY_FRAGMENT_PATH);
+	visionStaticGeometryProgram.init(STATIC_GEOMETRY_VERTEX_PATH, VISION_GEOMETRY_FRAGMENT_PATH);
+	multiVisionStaticGeometryProgram.init(STATIC_GEOMETRY_VERTEX_PATH, MULTI_VISION_GEOMETRY_FRAGMENT_PATH);
+
+	ShaderProgram* staticPrograms[] = { &staticGeometryProgram, &visionStaticGeometryProgram, &multiVisionStaticGeometryProgram };
+
+	for (ShaderProgram* program : staticPrograms) {
+		program->addAttribute("vertexPosition");
+		program->addAttribute("vertexColor");
+		program->linkShaders();
+	}
+
+	multiVisionStaticGeometryProgram.bindUniformBlock(LIGHT_BLOCK_NAME, LIGHT_BLOCK_BINDING);
+
+	uploadTextureUnits();
 }
 
 void Renderer::begin() {
+	// GLState statistics are counted per frame
+	GLState::resetStatistics();
 	reset();
+	updateView();
+
+	// camera matrix is uploaded only when it was changed
+	cameraBuffer.upload();
 }
 
 void Renderer::end() {
+	PROFILE_FUNCTION();
+	MEMORY_SCOPE(MemoryTag::RENDERER);
+	mergeContexts();
 	uploadVertexData();
+	uploadLightData();
+	submitStaticGeometry();
+	batchObjects();
 	draw();
+	fenceVertexData();
 }
 
-void Renderer::uploadVertexData() {
-	glBindBuffer(GL_ARRAY_BUFFER, vertexBuffers[0]);
-	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), nullptr, GL_DYNAMIC_DRAW);
-	glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(Vertex), vertices.data());
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+void Renderer::batchObjects() {
+	PROFILE_FUNCTION();
+	objectCount = renderQueue.getSize();
+
+	// one sort orders the whole frame by pass, blend, program, light and texture
+	renderQueue.sort();
+
+	// neighbours with the same state are merged when their ranges follow each other
+	renderCommands.clear();
+	for (int i = 0; i < renderQueue.getSize(); i++) {
+		const RenderCommand& command = renderQueue.get(i);
+
+		if (renderCommands.empty() || !mergeCommands(renderCommands.back(), command)) {
+			renderCommands.push_back(command);
+		}
+	}
+}
+
+bool Renderer::mergeCommands(RenderCommand& command, const RenderCommand& next) {
+	if (command.source == VertexSource::STATIC || command.source != next.source) {
+		return false;
+	}
 
-	glBindBuffer(GL_ARRAY_BUFFER, vertexBuffers[1]);
-	glBufferData(GL_ARRAY_BUFFER, textureVetrices.size() * sizeof(Vertex), nullptr, GL_DYNAMIC_DRAW);
-	glBufferSubData(GL_ARRAY_BUFFER, 0, textureVetrices.size() * sizeof(Vertex), textureVetrices.data());
-	glBindBuffer(GL_ARRAY_BUFFER, 0);	
+	if (command.pass != next.pass || command.program != next.program || command.blend != next.blend || command.light != next.light || command.textureID != next.textureID) {
+		return false;
+	}
+
+	return command.object.merge(next.object);
 }
 
-void Renderer::draw() {
-	if (mode == RenderMode::DEFAULT) {
-		bindVertexArray(vertexArrays[0]);
+void Renderer::uploadVertexData() {
+	renderedVertices.add(vertexBuffers[0].getSize() + vertexBuffers[1].getSize());
+	renderedInstances.add(vertexBuffers[2].getSize());
+
+	// vertices are already in the buffers, just finish writing
+	vertexBuffers[0].end();
+	vertexBuffers[1].end();
+	vertexBuffers[2].end();
+
+	// buffers were replaced while growing, vertex arrays have to point to the new ones
+	if (vertexBuffers[0].isResized() || vertexBuffers[1].isResized() || vertexBuffers[2].isResized()) {
+		quadIndexBuffer.reserve(glm::max(vertexBuffers[0].getCapacity(), vertexBuffers[1].getCapacity()) / QUAD_VERTICES);
+		initVertexAttributes();
+	}
+}
 
-		// draw geometry
-		geometryProgram.use();
-		drawGeometry();
-		geometryProgram.unuse();
+void Renderer::uploadLightData() {
+	// lights are uploaded once, not set as uniforms before every object
+	if (mode == RenderMode::MULTI_SHADOWS) {
+		lightBuffer.upload(lights);
+	}
+}
 
-		bindVertexArray(vertexArrays[1]);
+void Renderer::fenceVertexData() {
+	vertexBuffers[0].fence();
+	vertexBuffers[1].fence();
+	vertexBuffers[2].fence();
+}
 
-		// draw texture
-		textureProgram.use();
-		drawTexture();
-		textureProgram.unuse();
+void Renderer::draw() {
+	PROFILE_FUNCTION();
+	// commands are sorted, so state is changed only where it differs from the previous command
+	stateBound = false;
 
-		unbindVertexArray();
+	if (gpuTiming) {
+		gpuTimer.beginFrame();
 	}
-	else if(mode == RenderMode::SHADOWS) {
-		bindVertexArray(vertexArrays[0]);
 
-		// draw light mask
-		geometryProgram.use();
-		drawLightMask();
-		geometryProgram.unuse();
+	beginLightAccumulation();
+
+	for (size_t i = 0; i < renderCommands.size(); i++) {
+		const RenderCommand& command = renderCommands[i];
 
-		// draw visible objects and light
-		visionGeometryProgram.use();
-		drawVisibleObjects();
-		drawLight();
-		visionGeometryProgram.unuse();
+		// lighting passes are sorted first, textures are drawn at full resolution over upsampled lighting
+		if (accumulating && !isLightingPass(command.pass)) {
+			endLightAccumulation();
+		}
 
-		bindVertexArray(vertexArrays[1]);
+		// queued ranges belong to the previous pass, so they are drawn before its query ends
+		if (gpuTiming && (i == 0 || command.pass != renderCommands[i - 1].pass)) {
+			flushObjects();
+			gpuTimer.begin(getPassName(command.pass));
+		}
 
-		// draw texture
-		visionTextureProgram.use();	
-		drawVisibleTexture();
-		visionTextureProgram.unuse();
+		bindState(command);
 
-		unbindVertexArray();
+		if (command.source == VertexSource::STATIC) {
+			drawStaticGeometry(command.light);
+		}
+		else {
+			drawObject(command.object, vertexBuffers[(int)command.source]);
+		}
 	}
+
+	endLightAccumulation();
+	flushObjects();
+	unbindVertexArray();
+	gpuTimer.end();
+
+	drawCalls.add(getDrawCallCount());
 }
 
-void Renderer::drawLight() {
-	// this must be a way of drawing lights, otherwise space between visible blocks won't be filled with color
-	glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE, GL_ZERO, GL_ONE);
+void Renderer::beginLightAccumulation() {
+	if (!lightAccumulation || mode == RenderMode::DEFAULT) {
+		return;
+	}
 
-	GLint radiusLocation = visionGeometryProgram.getUniformValueLocation("visionRadius");
-	GLint centerLocation = visionGeometryProgram.getUniformValueLocation("visionCenter");
-	GLint intensityLocation = visionGeometryProgram.getUniformValueLocation("intensity");
+	lightAccumulationBuffer.resize(camera->getScreenWidth(), camera->getScreenHeight());
+	lightAccumulationBuffer.begin();
+	accumulating = true;
+}
 
-	for (size_t i = 0; i < lights.size(); i++) {
-		Light* light = lights[i];
+void Renderer::endLightAccumulation() {
+	if (!accumulating) {
+		return;
+	}
 
-		glUniform1f(radiusLocation, light->getRadius());
-		glUniform1f(intensityLocation, light->getIntensity());
-		glUniform2f(centerLocation, light->getSource().x, light->getSource().y);
+	// ranges queued for the accumulation buffer must be drawn before it is unbound
+	flushObjects();
+	lightAccumulationBuffer.end();
+	drawCallCount++;
+	accumulating = false;
 
+	// composite changed program, vertex array, texture and blend behind bindState
+	stateBound = false;
+}
 
-		std::vector<GLSL_Object> lightVector = lightArea[light->getID()];
+bool Renderer::isLightingPass(RenderPass pass) const {
+	return pass == RenderPass::LIGHT_MASK || pass == RenderPass::LIGHTMAP || pass == RenderPass::VISIBLE || pass == RenderPass::LIGHT || pass == RenderPass::STATIC;
+}
 
-		for (size_t i = 0; i < lightVector.size(); i++) {
-			GLSL_Object visibleObject = lightVector[i];
-			glDrawArrays(visibleObject.getMode(), visibleObject.getOffset(), visibleObject.getVertexNumber());
+void Renderer::drawStaticGeometry(int light) {
+	std::vector<Square> areas;
+
+	if (light == NO_LIGHT) {
+		areas.push_back(camera->getBounds());
+	}
+	else if (light == ALL_LIGHTS) {
+		// chunk is drawn once if any light on screen reaches it
+		for (size_t i = 0; i < lights.size(); i++) {
+			if (Collision::squareCollision(camera->getBounds(), lights[i]->getBounds())) {
+				areas.push_back(lights[i]->getBounds());
+			}
 		}
 	}
+	else {
+		areas.push_back(lights[(size_t)LightSlot::toIndex(light)]->getBounds());
+	}
+
+	staticGeometry.draw(areas, multiDraw);
 }
 
-void Renderer::drawGeometry() {
-	for (size_t i = 0; i < geometryObjects.size(); i++) {
-		GLSL_Object object = geometryObjects[i];
-		glDrawArrays(object.getMode(), object.getOffset(), object.getVertexNumber());
+void Renderer::drawObject(const GLSL_Object& object, const RingBuffer& vertexBuffer) {
+	// object offsets are relative to the section written in this frame
+	GLint baseVertex = vertexBuffer.getBaseVertex() + object.getOffset();
+
+	if (object.isInstanced()) {
+		// instanced draws can't be collected, submit queued ranges first to keep the order
+		flushObjects();
+		drawInstances(object, baseVertex);
+		drawCallCount++;
+	}
+	else if (object.isIndexed()) {
+		// quads share one index buffer, base vertex moves it to the object's vertices
+		multiDraw.addElements(object.getMode(), object.getIndexNumber(), baseVertex);
+	}
+	else {
+		multiDraw.addArrays(object.getMode(), baseVertex, object.getVertexNumber());
 	}
 }
 
-void Renderer::drawTexture() {
-	uploadTextureUnit();
-	for (size_t i = 0; i < textureObjects.size(); i++) {
-		GLSL_Texture texture = textureObjects[i];
-		glBindTexture(GL_TEXTURE_2D, texture.getTextureID());
-		glDrawArrays(texture.getMode(), texture.getOffset(), texture.getVertexNumber());
-	}
+void Renderer::flushObjects() {
+	// must be called before any state change, queued ranges use the current program and uniforms
+	multiDraw.draw();
 }
 
-void Renderer::drawLightMask() {
-	// create alpha mask
-	glBlendFuncSeparate(GL_ZERO, GL_ZERO, GL_SRC_ALPHA, GL_ZERO);
-	for (size_t i = 0; i < lightTriangles.size(); i++) {
-		GLSL_Triangle triangle = lightTriangles[i];
-		glDrawArrays(triangle.getMode(), triangle.getOffset(), triangle.getVertexNumber());
+void Renderer::drawInstances(const GLSL_Object& object, GLint baseInstance) {
+	if (GLEW_ARB_base_instance) {
+		GraphicsBackend::get().drawArraysInstancedBaseInstance(object.getMode(), 0, object.getVertexNumber(), object.getInstanceNumber(), baseInstance);
+	}
+	else {
+		// without base instance attributes have to start at the first instance of the object
+		bindInstanceAttributes(baseInstance);
+		GraphicsBackend::get().drawArraysInstanced(object.getMode(), 0, object.getVertexNumber(), object.getInstanceNumber());
 	}
 }
 
-void Renderer::drawVisibleObjects() {
-	// use alpah mask
-	glBlendFunc(GL_DST_ALPHA, GL_ONE);
+void Renderer::bindState(const RenderCommand& command) {
+	bool programChanged = !stateBound || currentProgram != command.program;
+	bool sourceChanged = !stateBound || currentSource != command.source;
+	bool blendChanged = !stateBound || currentBlend != command.blend;
+	bool lightChanged = programChanged || currentLight != command.light;
+	bool textureChanged = command.textureID != 0 && (!stateBound || currentTexture != command.textureID);
 
-	// draw geometry
-	GLint radiusLocation = visionGeometryProgram.getUniformValueLocation("visionRadius");
-	GLint centerLocation = visionGeometryProgram.getUniformValueLocation("visionCenter");
-	GLint intensityLocation = visionGeometryProgram.getUniformValueLocation("intensity");
+	if (!programChanged && !sourceChanged && !blendChanged && !lightChanged && !textureChanged) {
+		return;
+	}
 
-	for (size_t i = 0; i < lights.size(); i++) {
-		Light* light = lights[i];
+	// queued ranges were recorded with the previous state
+	flushObjects();
 
-		glUniform1f(radiusLocation, light->getRadius());
-		glUniform1f(intensityLocation, light->getIntensity());
-		glUniform2f(centerLocation, light->getSource().x, light->getSource().y);
+	if (sourceChanged) {
+		bool isStatic = command.source == VertexSource::STATIC;
+		bindVertexArray(isStatic ? staticGeometry.getVertexArrayID() : vertexArrays[(int)command.source]);
+		stateChanges.vertexArrays++;
+	}
 
-		std::vector<GLSL_Object> visibleVector = visibleArea[light->getID()];
+	if (programChanged) {
+		getProgram(command.program).use();
+		stateChanges.programs++;
+	}
 
-		for (size_t i = 0; i < visibleVector.size(); i++) {
-			GLSL_Object visibleObject = visibleVector[i];
-			glDrawArrays(visibleObject.getMode(), visibleObject.getOffset(), visibleObject.getVertexNumber());
-		}
+	if (blendChanged && command.blend != BlendMode::NONE) {
+		bindBlend(command.blend);
+		stateChanges.blends++;
 	}
-}
 
-void Renderer::drawVisibleTexture() {
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	// uniforms belong to the program, so light is uploaded again after every program change
+	if (lightChanged && command.light != NO_LIGHT) {
+		bindLight(command.program, command.light);
+		stateChanges.lights++;
+	}
 
-	uploadTextureUnit();
+	if (textureChanged) {
+		bindTexture(command.textureID, command.source);
+		currentTexture = command.textureID;
+		stateChanges.textures++;
+	}
 
-	GLint radiusLocation = visionTextureProgram.getUniformValueLocation("visionRadius");
-	GLint centerLocation = visionTextureProgram.getUniformValueLocation("visionCenter");
-	GLint intensityLocation = visionTextureProgram.getUniformValueLocation("intensity");
+	currentProgram = command.program;
+	currentSource = command.source;
+	currentBlend = command.blend;
+	currentLight = command.light;
+	stateBound = true;
+}
+
+void Renderer::bindBlend(BlendMode blend) {
+	switch (blend) {
+	case BlendMode::LIGHT_MASK:
+		// create alpha mask
+		GLState::blendFuncSeparate(GL_ZERO, GL_ZERO, GL_SRC_ALPHA, GL_ZERO);
+		break;
+	case BlendMode::ALPHA_MASK:
+		// use alpha mask
+		GLState::blendFunc(GL_DST_ALPHA, GL_ONE);
+		break;
+	case BlendMode::LIGHT:
+		// this must be a way of drawing lights, otherwise space between visible blocks won't be filled with color
+		GLState::blendFuncSeparate(GL_SRC_ALPHA, GL_ONE, GL_ZERO, GL_ONE);
+		break;
+	case BlendMode::ALPHA:
+		GLState::blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		break;
+	case BlendMode::ADDITIVE:
+		// lightmap adds its color and its part of the alpha mask
+		GLState::blendFunc(GL_ONE, GL_ONE);
+		break;
+	default:
+		// blending set by the game is kept
+		break;
+	}
+}
 
-	for (size_t i = 0; i < lights.size(); i++) {
-		Light* light = lights[i];
+void Renderer::bindLight(RenderProgram program, int light) {
+	if (light == NO_LIGHT) {
+		return;
+	}
 
-		glUniform1f(radiusLocation, light->getRadius());
-		glUniform1f(intensityLocation, light->getIntensity());
-		glUniform2f(centerLocation, light->getSource().x, light->getSource().y);
+	ShaderProgram& shaderProgram = getProgram(program);
 
-		std::vector<GLSL_Texture> textureVector = visibleTextureArea[light->getID()];
+	// multi shadow programs read lights from light buffer, -1 means that every light is evaluated
+	if (program == RenderProgram::MULTI_VISION_GEOMETRY || program == RenderProgram::MULTI_VISION_INSTANCE_GEOMETRY || program == RenderProgram::MULTI_VISION_STATIC_GEOMETRY) {
+		GraphicsBackend::get().uniform1i(shaderProgram.getUniformValueLocation("lightIndex"), light == ALL_LIGHTS ? -1 : LightSlot::toIndex(light));
+		return;
+	}
 
-		for (size_t i = 0; i < textureVector.size(); i++) {
-			GLSL_Texture visibleTexture = textureVector[i];
-			glBindTexture(GL_TEXTURE_2D, visibleTexture.getTextureID());
-			glDrawArrays(visibleTexture.getMode(), visibleTexture.getOffset(), visibleTexture.getVertexNumber());
-		}
+	if (light == ALL_LIGHTS) {
+		return;
 	}
 
-}
+	Light* source = lights[(size_t)LightSlot::toIndex(light)];
 
-void Renderer::bindVertexArray(GLuint vertexArrayID) {
-	glBindVertexArray(vertexArrayID);
-}
+	// lightmap already holds shadows and falloff, only the animated intensity is left
+	if (program == RenderProgram::LIGHTMAP) {
+		GraphicsBackend::get().uniform1f(shaderProgram.getUniformValueLocation("intensity"), source->getIntensity());
+		return;
+	}
 
-void Renderer::unbindVertexArray() {
-	glBindVertexArray(0);
+	GraphicsBackend::get().uniform1f(shaderProgram.getUniformValueLocation("visionRadius"), source->getRadius());
+	GraphicsBackend::get().uniform1f(shaderProgram.getUniformValueLocation("intensity"), source->getIntensity());
+	GraphicsBackend::get().uniform2f(shaderProgram.getUniformValueLocation("visionCenter"), source->getSource().x, source->getSource().y);
 }
 
-void Renderer::uploadTextureUnit() {
-	glActiveTexture(GL_TEXTURE0);
-	GLuint textureLocation = visionTextureProgram.getUniformValueLocation("asset");
-	glUniform1i(textureLocation, 0);
-}
+void Renderer::bindTexture(GLuint textureID, VertexSource source) {
+	// instanced rectangles sample texture arrays, so same sized textures share one bind
+	GLenum target = source == VertexSource::RECT ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
 
-// draw square
-void Renderer::drawSquare(float x, float y, float width, float height, Color color) {
-	geometryObjects.emplace_back(GLSL_Square(x, y, width, height, color, offset, vertices));
+	// ranges queued with the previous texture have to be drawn before it changes
+	if (GLState::getTexture(target) != textureID) {
+		flushObjects();
+		GLState::bindTexture(target, textureID);
+	}
 }
 
-void Renderer::drawSquare(Square square, Color color) {
-	drawSquare(square.getX(), square.getY(), square.getWidth(), square.getHeight(), color);
+void Renderer::bindVertexArray(GLuint vertexArrayID) {
+	GLState::bindVertexArray(vertexArrayID);
 }
 
-void Renderer::drawSquare(Square square) {
-	drawSquare(square.getX(), square.getY(), square.getWidth(), square.getHeight(), square.getColor());
+void Renderer::unbindVertexArray() {
+	GLState::bindVertexArray(0);
 }
 
-// draw circle
-void Renderer::drawCircle(float x, float y, float radius, int segments, Color color) {
-	geometryObjects.emplace_back(GLSL_Circle(x, y, radius, segments, color, offset, vertices));
+void Renderer::bindInstanceAttributes(GLint baseInstance) {
+	GLState::bindBuffer(GL_ARRAY_BUFFER, vertexBuffers[2].getBufferID());
+	vertexFormats[2].bindAttributes((size_t)baseInstance * vertexFormats[2].getStride());
 }
 
-void Renderer::drawCircle(glm::vec2 center, float radius, int segments, Color color) {
-	drawCircle(center.x, center.y, radius, segments, color);
+void Renderer::uploadTextureUnit(ShaderProgram& program) {
+	GLState::activeTexture(GL_TEXTURE0);
+	GLuint textureLocation = program.getUniformValueLocation("asset");
+	GraphicsBackend::get().uniform1i(textureLocation, 0);
 }
 
-void Renderer::drawCircle(Circle circle, Color color) {
-	drawCircle(circle.getX(), circle.getY(), circle.getRadius(), circle.getSegments(), color);
-}
+void Renderer::uploadTextureUnits() {
+	// sampler uniforms keep their value, so texture unit is set once after linking
+	ShaderProgram* texturePrograms[] = { &textureProgram, &visionTextureProgram, &instanceTextureProgram, &visionInstanceTextureProgram, &multiVisionTextureProgram, &multiVisionInstanceTextureProgram, &lightmapProgram };
 
-void Renderer::drawCircle(Circle circle) {
-	drawCircle(circle.getX(), circle.getY(), circle.getRadius(), circle.getSegments(), circle.getColor());
-}
+	for (ShaderProgram* program : texturePrograms) {
+		program->use();
+		uploadTextureUnit(*program);
+	}
 
-// draw triangle
-void Renderer::drawTriangle(glm::vec2 p1, glm::vec2 p2, glm::vec2 p3, Color color) {
-	geometryObjects.emplace_back(GLSL_Triangle(p1, p2, p3, color, offset, vertices));
+	GLState::useProgram(0);
 }
 
-void Renderer::drawTriangle(Triangle triangle, Color color) {
-	drawTriangle(triangle.getP1(), triangle.getP2(), triangle.getP3(), color);
-}
+void Renderer::uploadStaticBounds() {
+	// bounds change only when static geometry is built, uniforms keep their value until then
+	ShaderProgram* staticPrograms[] = { &staticGeometryProgram, &visionStaticGeometryProgram, &multiVisionStaticGeometryProgram };
 
-void Renderer::drawTriangle(Triangle triangle) {
-	drawTriangle(triangle.getP1(), triangle.getP2(), triangle.getP3(), triangle.getColor());
-}
+	glm::vec2 origin = staticGeometry.getOrigin();
+	glm::vec2 extent = staticGeometry.getExtent();
 
-// draw line
-void Renderer::drawLine(glm::vec2 p1, glm::vec2 p2, Color color) {
-	geometryObjects.emplace_back(GLSL_Line(p1, p2, color, offset, vertices));
-}
+	for (ShaderProgram* program : staticPrograms) {
+		program->use();
+		GraphicsBackend::get().uniform2f(program->getUniformValueLocation("staticOrigin"), origin.x, origin.y);
+		GraphicsBackend::get().uniform2f(program->getUniformValueLocation("staticExtent"), extent.x, extent.y);
+	}
 
-void Renderer::drawLine(float x, float y, float x1, float y1, Color color) {
-	geometryObjects.emplace_back(GLSL_Line(glm::vec2(x, y), glm::vec2(x1, y1), color, offset, vertices));
+	GLState::useProgram(0);
 }
 
-void Renderer::drawLine(Line line, Color color) {
-	drawLine(line.getP1(), line.getP2(), color);
+// static geometry
+void Renderer::addStaticSquare(Square square, Color color) {
+	staticGeometry.addSquare(square.getX(), square.getY(), square.getWidth(), square.getHeight(), color);
 }
 
-void Renderer::drawLine(Line line) {
-	drawLine(line.getP1(), line.getP2(), line.getColor());
+void Renderer::buildStaticGeometry() {
+	staticGeometry.build(quadIndexBuffer);
+	uploadStaticBounds();
 }
 
-// draw point
-void Renderer::drawPoint(glm::vec2 p, Color color) {
-	geometryObjects.emplace_back(GLSL_Point(p, color, offset, vertices));
+void Renderer::clearStaticGeometry() {
+	staticGeometry.clear();
 }
 
-void Renderer::drawPoint(float x, float y, Color color) {
-	drawPoint(glm::vec2(x, y), color);
+// baked lights
+void Renderer::bakeLights(const std::vector<Light*>& lights, const std::vector<Square>& occluders) {
+	for (size_t i = 0; i < lights.size(); i++) {
+		Lightmap lightmap = LightmapBaker::bake(*lights[i], occluders);
+		GLTexture texture = ImageLoader::createTexture(lightmap.pixels, lightmap.width, lightmap.height);
+
+		// neighbouring lights must not wrap into the quad
+		GLState::bindTexture(GL_TEXTURE_2D, texture.ID);
+		GraphicsBackend::get().texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		GraphicsBackend::get().texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		GLState::bindTexture(GL_TEXTURE_2D, 0);
+
+		auto it = lightmaps.find(lights[i]->getID());
+		if (it != lightmaps.end()) {
+			GLState::deleteTexture(it->second.ID);
+		}
+		lightmaps[lights[i]->getID()] = texture;
+	}
 }
 
-void Renderer::drawPoint(Point point, Color color) {
-	drawPoint(point.getX(), point.getY(), color);
+void Renderer::clearLightmaps() {
+	for (auto it = lightmaps.begin(); it != lightmaps.end(); it++) {
+		GLState::deleteTexture(it->second.ID);
+	}
+	lightmaps.clear();
 }
 
-void Renderer::drawPoint(Point point) {
-	drawPoint(point.getX(), point.getY(), point.getColor());
+bool Renderer::isLightBaked(Light* light) const {
+	return lightmaps.find(light->getID()) != lightmaps.end();
 }
 
-// draw texture
-void Renderer::drawTexture(float x, float y, float width, float height, GLTexture texture) {
-	textureObjects.emplace_back(x, y, width, height, glm::vec4(0.0f, 0.0f, 1.0f, 1.0f), texture, textureOffset, textureVetrices);
-}
+void Renderer::submitStaticGeometry() {
+	if (staticGeometry.isEmpty()) {
+		return;
+	}
 
-void Renderer::drawTexture(Square square, GLTexture texture) {
-	drawTexture(square.getX(), square.getY(), square.getWidth(), square.getHeight(), texture);
+	if (mode == RenderMode::DEFAULT) {
+		submit(RenderPass::STATIC, GLSL_Object(), VertexSource::STATIC);
+	}
+	else if (mode == RenderMode::SHADOWS) {
+		// every light on screen draws chunks it reaches
+		for (size_t i = 0; i < lights.size(); i++) {
+			if (Collision::squareCollision(camera->getBounds(), lights[i]->getBounds())) {
+				submit(RenderPass::STATIC, GLSL_Object(), VertexSource::STATIC, 0, LightSlot::fromIndex((int)i));
+			}
+		}
+	}
+	else {
+		submit(RenderPass::STATIC, GLSL_Object(), VertexSource::STATIC, 0, ALL_LIGHTS);
+	}
 }
 
-void Renderer::drawTexture(float x, float y, float width, float height, TextureAtlas textureAtlas, int textureIndex) {
-	textureObjects.emplace_back(x, y, width, height, textureAtlas.getUV(textureIndex), textureAtlas.getTexture(), textureOffset, textureVetrices);
+bool Renderer::isPassEnabled(RenderPass pass) const {
+	if (mode == RenderMode::DEFAULT) {
+		return pass == RenderPass::GEOMETRY || pass == RenderPass::STATIC || pass == RenderPass::TEXTURE;
+	}
+	return pass != RenderPass::GEOMETRY && pass != RenderPass::TEXTURE;
 }
 
-void Renderer::drawTexture(Square square, TextureAtlas textureAtlas, int textureIndex) {
-	drawTexture(square.getX(), square.getY(), square.getWidth(), square.getHeight(), textureAtlas, textureIndex);
+// culling
+void Renderer::updateView() {
+	Square bounds = camera->getBounds();
+	viewMin = bounds.getPosition();
+	viewMax = viewMin + bounds.getDimensions();
 }
 
-// draw light
-void Renderer::drawLight(Light* light) {
-	Square square = light->getBounds();
-	lightArea[light->getID()].emplace_back(GLSL_Square(square.getX(), square.getY(), square.getWidth(), square.getHeight(), square.getColor(), offset, vertices));
+// contexts
+void Renderer::mergeContexts() {
+	PROFILE_FUNCTION();
+	// contexts are merged in their order, keys equal across contexts keep that order after sort
+	for (size_t i = 0; i < contexts.size(); i++) {
+		mergeContext(contexts[i]);
+	}
 }
 
-// draw light mask
-void  Renderer::drawLightMask(glm::vec2 p1, glm::vec2 p2, glm::vec2 p3, Color color) {
-	lightTriangles.emplace_back(p1, p2, p3, color, offset, vertices);
-}
+void Renderer::mergeContext(RenderContext& context) {
+	int baseOffsets[3];
 
-// draw vivible objects
-void Renderer::drawSquare(Light* light, Square square, Color color) {
-	visibleArea[light->getID()].emplace_back(GLSL_Square(square.getX(), square.getY(), square.getWidth(), square.getHeight(), color, offset, vertices));
-}
+	// recorded vertices go behind the ones written in this frame, offsets are patched by the same amount
+	for (int i = 0; i < 3; i++) {
+		const VertexStaging& staging = context.vertexStagings[i];
+		baseOffsets[i] = vertexBuffers[i].getSize();
 
-void Renderer::drawTexture(Light* light, Square square, GLTexture texture) {
-	visibleTextureArea[light->getID()].emplace_back(GLSL_Texture(square.getX(), square.getY(), square.getWidth(), square.getHeight(), glm::vec4(0.0f, 0.0f, 1.0f, 1.0f), texture, textureOffset, textureVetrices));
+		if (staging.getSize() > 0) {
+			void* vertices = vertexBuffers[i].allocate(staging.getSize());
+			memcpy(vertices, staging.getData(), (size_t)staging.getSize() * staging.getStride());
+		}
+	}
+
+	// queue is not sorted yet, records are still in submission order
+	for (int i = 0; i < context.commands.getSize(); i++) {
+		RenderCommand command = context.commands.get(i);
+		command.object.relocate(baseOffsets[(int)command.source]);
+		renderQueue.add(context.commands.getKey(i), command);
+	}
+
+	culledCount = culledCount + context.culledCount;
 }
 
 // reset
 void Renderer::reset() {
-	vertices.clear();
-	textureVetrices.clear();
+	vertexBuffers[0].begin();
+	vertexBuffers[1].begin();
+	vertexBuffers[2].begin();
 
-	geometryObjects.clear();
-	textureObjects.clear();
-	lightTriangles.clear();
-	lightObjects.clear();
+	objectCount = 0;
+	drawCallCount = 0;
+	multiDraw.resetDrawCalls();
 
-	offset = 0;
-	textureOffset = 0;
+	stateChanges = StateChanges();
 
-	if (mode == RenderMode::SHADOWS) {
-		for (auto& x : visibleArea) {
-			x.second.clear();
-		}
+	renderQueue.clear();
+	renderCommands.clear();
 
-		for (auto& x : visibleTextureArea) {
-			x.second.clear();
-		}
+	RenderContext::reset();
+	for (size_t i = 0; i < contexts.size(); i++) {
+		contexts[i].reset();
+	}
+}
 
-		for (auto& x : lightArea) {
-			x.second.clear();
+int Renderer::getLightIndex(Light* light) {
+	// lights which were not passed to setLights are not drawn
+	auto it = lightIndices.find(light->getID());
+	if (it == lightIndices.end()) {
+		return -1;
+	}
+	return it->second;
+}
+
+ShaderProgram& Renderer::getProgram(RenderProgram program) {
+	switch (program) {
+	case RenderProgram::TEXTURE:
+		return textureProgram;
+	case RenderProgram::VISION_GEOMETRY:
+		return visionGeometryProgram;
+	case RenderProgram::VISION_TEXTURE:
+		return visionTextureProgram;
+	case RenderProgram::INSTANCE_GEOMETRY:
+		return instanceGeometryProgram;
+	case RenderProgram::INSTANCE_TEXTURE:
+		return instanceTextureProgram;
+	case RenderProgram::VISION_INSTANCE_GEOMETRY:
+		return visionInstanceGeometryProgram;
+	case RenderProgram::VISION_INSTANCE_TEXTURE:
+		return visionInstanceTextureProgram;
+	case RenderProgram::MULTI_VISION_GEOMETRY:
+		return multiVisionGeometryProgram;
+	case RenderProgram::MULTI_VISION_TEXTURE:
+		return multiVisionTextureProgram;
+	case RenderProgram::MULTI_VISION_INSTANCE_GEOMETRY:
+		return multiVisionInstanceGeometryProgram;
+	case RenderProgram::MULTI_VISION_INSTANCE_TEXTURE:
+		return multiVisionInstanceTextureProgram;
+	case RenderProgram::LIGHTMAP:
+		return lightmapProgram;
+	case RenderProgram::STATIC_GEOMETRY:
+		return staticGeometryProgram;
+	case RenderProgram::VISION_STATIC_GEOMETRY:
+		return visionStaticGeometryProgram;
+	case RenderProgram::MULTI_VISION_STATIC_GEOMETRY:
+		return multiVisionStaticGeometryProgram;
+	default:
+		return geometryProgram;
+	}
+}
+
+RenderProgram Renderer::getProgram(RenderPass pass, VertexSource source, int light) const {
+	bool instanced = source == VertexSource::RECT;
+
+	switch (pass) {
+	case RenderPass::LIGHT_MASK:
+		return RenderProgram::GEOMETRY;
+	case RenderPass::LIGHTMAP:
+		return RenderProgram::LIGHTMAP;
+	case RenderPass::GEOMETRY:
+		return instanced ? RenderProgram::INSTANCE_GEOMETRY : RenderProgram::GEOMETRY;
+	case RenderPass::TEXTURE:
+		return instanced ? RenderProgram::INSTANCE_TEXTURE : RenderProgram::TEXTURE;
+	case RenderPass::STATIC:
+		if (mode == RenderMode::SHADOWS) {
+			return RenderProgram::VISION_STATIC_GEOMETRY;
+		}
+		return mode == RenderMode::MULTI_SHADOWS ? RenderProgram::MULTI_VISION_STATIC_GEOMETRY : RenderProgram::STATIC_GEOMETRY;
+	case RenderPass::VISIBLE_TEXTURE:
+		if (mode == RenderMode::SHADOWS) {
+			return instanced ? RenderProgram::VISION_INSTANCE_TEXTURE : RenderProgram::VISION_TEXTURE;
+		}
+		return instanced ? RenderProgram::MULTI_VISION_INSTANCE_TEXTURE : RenderProgram::MULTI_VISION_TEXTURE;
+	default:
+		// visible objects and lights, lights which don't fit into the light buffer fall back to the single light program
+		if (mode == RenderMode::SHADOWS || (pass == RenderPass::LIGHT && LightSlot::toIndex(light) >= MAX_LIGHTS)) {
+			return instanced ? RenderProgram::VISION_INSTANCE_GEOMETRY : RenderProgram::VISION_GEOMETRY;
 		}
+		return instanced ? RenderProgram::MULTI_VISION_INSTANCE_GEOMETRY : RenderProgram::MULTI_VISION_GEOMETRY;
+	}
+}
+
+BlendMode Renderer::getBlend(RenderPass pass) const {
+	switch (pass) {
+	case RenderPass::LIGHT_MASK:
+		return BlendMode::LIGHT_MASK;
+	case RenderPass::LIGHTMAP:
+		return BlendMode::ADDITIVE;
+	case RenderPass::VISIBLE:
+		return BlendMode::ALPHA_MASK;
+	case RenderPass::LIGHT:
+		return BlendMode::LIGHT;
+	case RenderPass::STATIC:
+		return mode == RenderMode::DEFAULT ? BlendMode::NONE : BlendMode::ALPHA_MASK;
+	case RenderPass::VISIBLE_TEXTURE:
+		return BlendMode::ALPHA;
+	default:
+		return BlendMode::NONE;
+	}
+}
 
+const char* Renderer::getPassName(RenderPass pass) const {
+	switch (pass) {
+	case RenderPass::LIGHT_MASK:
+		return "GPU light mask";
+	case RenderPass::LIGHTMAP:
+		return "GPU lightmap";
+	case RenderPass::GEOMETRY:
+		return "GPU geometry";
+	case RenderPass::VISIBLE:
+		return "GPU visible";
+	case RenderPass::LIGHT:
+		return "GPU light";
+	case RenderPass::STATIC:
+		return "GPU static";
+	case RenderPass::TEXTURE:
+		return "GPU texture";
+	default:
+		return "GPU visible texture";
 	}
 }
 
@@ -418,9 +797,10 @@ bool Renderer::check() {
 
 // setters
 void Renderer::setLights(std::vector<Light*>& lights) {
+	// draw lists are sorted by the position of the light in this vector
+	lightIndices.clear();
 	for (size_t i = 0; i < lights.size(); i++) {
-		visibleArea[lights[i]->getID()] = std::vector<GLSL_Object>();
-		visibleTextureArea[lights[i]->getID()] = std::vector<GLSL_Texture>();
+		lightIndices[lights[i]->getID()] = (int)i;
 	}
 	this->lights = lights;
 }
@@ -428,3 +808,64 @@ void Renderer::setLights(std::vector<Light*>& lights) {
 void Renderer::setMode(RenderMode mode) {
 	this->mode = mode;
 }
+
+void Renderer::setInstancing(bool instancing) {
+	// must not be changed between begin and end
+	this->instancing = instancing;
+}
+
+void Renderer::setCulling(bool culling) {
+	this->culling = culling;
+}
+
+void Renderer::setLightAccumulation(bool lightAccumulation) {
+	// must not be changed between begin and end
+	this->lightAccumulation = lightAccumulation;
+}
+
+void Renderer::setContextNumber(int contextNumber) {
+	// must be called after init, contexts take the vertex formats of the buffers
+	contexts.assign(contextNumber, RenderContext(this));
+	for (size_t i = 0; i < contexts.size(); i++) {
+		contexts[i].reset();
+	}
+}
+
+void Renderer::setGPUTiming(bool gpuTiming) {
+	// must not be changed between begin and end
+	this->gpuTiming = gpuTiming;
+}
+
+void Renderer::setFrameTime(float frameTime) {
+	// resolution of the accumulation buffer follows the measured frame time
+	lightAccumulationBuffer.update(frameTime);
+}
+
+// getters
+RenderMode Renderer::getMode() const {
+	return mode;
+}
+
+RenderContext& Renderer::getContext(int index) {
+	return contexts[index];
+}
+
+int Renderer::getContextNumber() const {
+	return (int)contexts.size();
+}
+
+float Renderer::getLightScale() const {
+	return lightAccumulationBuffer.getScale();
+}
+
+int Renderer::getObjectCount() const {
+	return objectCount;
+}
+
+int Renderer::getDrawCallCount() const {
+	return drawCallCount + multiDraw.getDrawCalls();
+}
+
+const StateChanges& Renderer::getStateChanges() const {
+	return stateChanges;
+}
@@ -9,33 +9,55 @@
 #include "GLSL_Texture.h"
 #include "GLSL_Light.h"
 #include "GLSL_Triangle.h"
+#include "GLSL_Rect.h"
 #include "ShaderProgram.h"
 #include "GLTexture.h"
 #include "TextureAtlas.h"
+#include "RingBuffer.h"
+#include "VertexFormat.h"
+#include "QuadIndexBuffer.h"
+#include "MultiDraw.h"
+#include "LightBuffer.h"
+#include "StaticGeometry.h"
+#include "RenderQueue.h"
+#include "Camera2D.h"
+#include "CameraBuffer.h"
+#include "LightAccumulationBuffer.h"
+#include "LightmapBaker.h"
+#include "RenderContext.h"
+#include "GPUTimer.h"
 #include <vector>
 #include <unordered_map>
 
-enum class RenderMode {
-	DEFAULT,
-	SHADOWS
+// state changes issued while walking the sorted queue in the last frame
+struct StateChanges {
+	int programs;
+	int vertexArrays;
+	int blends;
+	int lights;
+	int textures;
 };
 
-class Renderer
+// Renderer is the direct render context of the main thread, worker threads record into
+// contexts returned by getContext and are merged in end.
+class Renderer : public RenderContext
 {
+	friend class RenderContext;
 private:
-	std::vector<GLSL_Object> geometryObjects;
-	std::vector<GLSL_Light> lightObjects;
-	std::vector<GLSL_Triangle> lightTriangles;
-	std::vector<GLSL_Texture> textureObjects;
+	// every submission of the frame, sorted by key in end()
+	RenderQueue<RenderCommand> renderQueue;
 
-	std::vector<Vertex> vertices;
-	std::vector<Vertex> textureVetrices;
+	// sorted commands after neighbours with the same state were merged
+	std::vector<RenderCommand> renderCommands;
 
-	std::unordered_map<int, std::vector<GLSL_Object>> visibleArea;
-	std::unordered_map<int, std::vector<GLSL_Texture>> visibleTextureArea;	
-	std::unordered_map<int, std::vector<GLSL_Object>> lightArea;
+	// recording contexts of worker threads
+	std::vector<RenderContext> contexts;
 
 	std::vector<Light*> lights;
+	std::unordered_map<int, int> lightIndices;
+
+	// lightmaps of baked lights by light ID
+	std::unordered_map<int, GLTexture> lightmaps;
 
 	// non shadow programs
 	ShaderProgram geometryProgram;
@@ -45,13 +67,67 @@ private:
 	ShaderProgram visionGeometryProgram;
 	ShaderProgram visionTextureProgram;
 
-	GLuint vertexArrays[2];
-	GLuint vertexBuffers[2];
+	// instanced programs
+	ShaderProgram instanceGeometryProgram;
+	ShaderProgram instanceTextureProgram;
+	ShaderProgram visionInstanceGeometryProgram;
+	ShaderProgram visionInstanceTextureProgram;
+
+	// multi shadow programs
+	ShaderProgram multiVisionGeometryProgram;
+	ShaderProgram multiVisionTextureProgram;
+	ShaderProgram multiVisionInstanceGeometryProgram;
+	ShaderProgram multiVisionInstanceTextureProgram;
+
+	// baked light program
+	ShaderProgram lightmapProgram;
+
+	// static geometry programs, one for every mode
+	ShaderProgram staticGeometryProgram;
+	ShaderProgram visionStaticGeometryProgram;
+	ShaderProgram multiVisionStaticGeometryProgram;
+
+	// 0 - geometry, 1 - texture, 2 - rect instances
+	GLuint vertexArrays[3];
+	VertexFormat vertexFormats[3];
+	RingBuffer vertexBuffers[3];
+	QuadIndexBuffer quadIndexBuffer;
+	MultiDraw multiDraw;
+	LightBuffer lightBuffer;
+	CameraBuffer cameraBuffer;
+	StaticGeometry staticGeometry;
 
-	int offset;
-	int textureOffset;
+	// shadow modes draw lighting passes here and upsample them before textures
+	LightAccumulationBuffer lightAccumulationBuffer;
+
+	// GPU time of every pass, reported to the profiler
+	GPUTimer gpuTimer;
+
+	Camera2D* camera;
 
 	RenderMode mode;
+	bool instancing;
+	bool culling;
+	bool lightAccumulation;
+	bool accumulating;
+	bool gpuTiming;
+
+	// state of the last submitted command
+	RenderProgram currentProgram;
+	VertexSource currentSource;
+	BlendMode currentBlend;
+	int currentLight;
+	GLuint currentTexture;
+	bool stateBound;
+
+	// camera bounds of the current frame, objects outside are not submitted
+	glm::vec2 viewMin;
+	glm::vec2 viewMax;
+
+	// statistics of the last frame, object count is the number of submitted objects
+	int objectCount;
+	int drawCallCount;
+	StateChanges stateChanges;
 public:
 	// constructors
 	Renderer();
@@ -60,49 +136,26 @@ public:
 	// inits
 	void init(Camera2D& camera);
 
-	// ========================== < NON-LIGHT DRAWING > ========================== //
-
-	// draw square
-	void drawSquare(float x, float y, float width, float height, Color color = WHITE);
-	void drawSquare(Square square, Color color);
-	void drawSquare(Square square);
-
-	// draw circle
-	void drawCircle(glm::vec2 center, float radius, int segments = SEGMENT_NUMBER, Color color = WHITE);
-	void drawCircle(float x, float y, float radius, int segments = SEGMENT_NUMBER, Color color = WHITE);
-	void drawCircle(Circle circle, Color color);
-	void drawCircle(Circle circle);
-
-	// draw triangle
-	void drawTriangle(glm::vec2 p1, glm::vec2 p2, glm::vec2 p3, Color color = WHITE);
-	void drawTriangle(Triangle triangle, Color color);
-	void drawTriangle(Triangle triangle);
-
-	// draw line
-	void drawLine(glm::vec2 p1, glm::vec2 p2, Color color = WHITE);
-	void drawLine(float x, float y, float x1, float y1, Color color = WHITE);
-	void drawLine(Line line, Color color);
-	void drawLine(Line line);
-
-	// draw point
-	void drawPoint(glm::vec2 p, Color color = WHITE);
-	void drawPoint(float x, float y, Color color = WHITE);
-	void drawPoint(Point point, Color color);
-	void drawPoint(Point point);
-	
-	// draw texture
-	void drawTexture(float x, float y, float width, float height, GLTexture texture);
-	void drawTexture(float x, float y, float width, float height, TextureAtlas textureAtlas, int textureIndex);
-	void drawTexture(Square square, GLTexture texture);
-	void drawTexture(Square square, TextureAtlas textureAtlas, int textureIndex);
-
-	// ========================== < LIGHT DRAWING > ========================== //
-
-	// draw light mask
-	void drawLightMask(glm::vec2 p1, glm::vec2 p2, glm::vec2 p3, Color color = WHITE);
-	void drawLight(Light* light);
-	void drawSquare(Light* light, Square square, Color color);
-	void drawTexture(Light* light, Square square, GLTexture texture);
+	// ========================== < BAKED LIGHTS > ========================== //
+
+	// lights which never move are baked once, drawLight then draws their lightmap
+	void bakeLights(const std::vector<Light*>& lights, const std::vector<Square>& occluders);
+	void clearLightmaps();
+	bool isLightBaked(Light* light) const;
+
+	// ========================== < STATIC DRAWING > ========================== //
+
+	// static geometry is uploaded once by buildStaticGeometry and drawn every frame
+	void addStaticSquare(Square square, Color color);
+	void buildStaticGeometry();
+	void clearStaticGeometry();
+
+	// ========================== < RECORDING CONTEXTS > ========================== //
+
+	// one context per worker thread, must not be changed between begin and end
+	void setContextNumber(int contextNumber);
+	RenderContext& getContext(int index);
+	int getContextNumber() const;
 
 	// being / end
 	void begin();
@@ -111,33 +164,78 @@ public:
 	// setters
 	void setLights(std::vector<Light*>& lights);
 	void setMode(RenderMode mode);
+	void setInstancing(bool instancing);
+	void setCulling(bool culling);
+	void setLightAccumulation(bool lightAccumulation);
+	void setGPUTiming(bool gpuTiming);
+	void setFrameTime(float frameTime);
+
+	// getters
+	RenderMode getMode() const;
+	float getLightScale() const;
+	int getObjectCount() const;
+	int getDrawCallCount() const;
+	const StateChanges& getStateChanges() const;
 private:
 	// init
 	void init();
 	void initVertexArray();
-	void initShaderProgram(Camera2D& camera);
+	void initVertexAttributes();
+	void initShaderProgram();
+
+	// submit
+	void submitStaticGeometry();
+	bool isPassEnabled(RenderPass pass) const;
+
+	// culling
+	void updateView();
+
+	// contexts
+	void mergeContexts();
+	void mergeContext(RenderContext& context);
+
+	// batching
+	void batchObjects();
+	bool mergeCommands(RenderCommand& command, const RenderCommand& next);
 
 	// draw
 	void draw();
-	void drawLight();
-	void drawGeometry();
-	void drawTexture();
-	void drawVisibleTexture();
-	void drawLightMask();
-	void drawVisibleObjects();
+	void drawStaticGeometry(int light);
+	void drawObject(const GLSL_Object& object, const RingBuffer& vertexBuffer);
+	void drawInstances(const GLSL_Object& object, GLint baseInstance);
+	void flushObjects();
+
+	// light accumulation
+	void beginLightAccumulation();
+	void endLightAccumulation();
+	bool isLightingPass(RenderPass pass) const;
 
 	// bind / unbind
+	void bindState(const RenderCommand& command);
+	void bindBlend(BlendMode blend);
+	void bindLight(RenderProgram program, int light);
+	void bindTexture(GLuint textureID, VertexSource source);
 	void bindVertexArray(GLuint vertexArrayID);
 	void unbindVertexArray();
+	void bindInstanceAttributes(GLint baseInstance);
 
 	// upload
-	void uploadTextureUnit();
+	void uploadTextureUnit(ShaderProgram& program);
+	void uploadTextureUnits();
+	void uploadStaticBounds();
 	void uploadVertexData();
+	void uploadLightData();
+	void fenceVertexData();
 
 	// reset
 	void reset();
 
 	// helper
+	ShaderProgram& getProgram(RenderProgram program);
+	RenderProgram getProgram(RenderPass pass, VertexSource source, int light) const;
+	BlendMode getBlend(RenderPass pass) const;
+	const char* getPassName(RenderPass pass) const;
+	int getLightIndex(Light* light);
 	bool check();
 };
 
@@ -0,0 +1,88 @@
+#include "RendererBenchmark.h"
+#include "Renderer.h"
+#include "NullBackend.h"
+#include "TextureArray.h"
+#include "GLState.h"
+#include "Profiler.h"
+#include "Light.h"
+#include <iostream>
+#include <vector>
+
+// run
+void RendererBenchmark::run(int screenWidth, int screenHeight, int frames) {
+	NullBackend backend;
+	GraphicsBackend::set(&backend);
+
+	{
+		Camera2D camera(screenWidth / 2.0f, screenHeight / 2.0f, screenWidth / 2.0f, screenHeight / 2.0f);
+		camera.update();
+
+		Renderer renderer;
+		renderer.init(camera);
+		renderer.setMode(RenderMode::MULTI_SHADOWS);
+
+		// one texture in a texture array, so both the quad and the instanced path can draw it
+		int unit = (int)BENCHMARK_UNIT;
+		std::vector<unsigned char> pixels((size_t)unit * unit * 4, 255);
+		TextureArray textureArray;
+		textureArray.init(unit, unit);
+
+		GLTexture texture = {};
+		GraphicsBackend::get().genTextures(1, &texture.ID);
+		texture.width = unit;
+		texture.height = unit;
+		texture.layer = textureArray.addLayer(pixels);
+		texture.arrayID = textureArray.getTextureID();
+		textureArray.generateMipmaps();
+
+		std::vector<Light> lights(BENCHMARK_LIGHTS);
+		std::vector<Light*> lightPointers;
+		for (int i = 0; i < BENCHMARK_LIGHTS; i++) {
+			glm::vec2 source((i + 0.5f) * screenWidth / BENCHMARK_LIGHTS, screenHeight / 2.0f);
+			lights[i].init(10 * unit, 1.0f, source, Color(255, 255, 255, 255));
+			lightPointers.push_back(&lights[i]);
+		}
+		renderer.setLights(lightPointers);
+
+		GraphicsStatistics total = {};
+		long long totalTime = 0;
+
+		for (int frame = 0; frame < frames; frame++) {
+			backend.resetStatistics();
+			long long start = Profiler::now();
+
+			renderer.begin();
+
+			for (float y = 0.0f; y < screenHeight; y += BENCHMARK_UNIT) {
+				for (float x = 0.0f; x < screenWidth; x += BENCHMARK_UNIT) {
+					Square square(x, y, BENCHMARK_UNIT, BENCHMARK_UNIT);
+					renderer.drawVisibleSquare(square, Color(0, 255, 0, 255));
+					renderer.drawTexture(square, texture);
+				}
+			}
+
+			for (size_t i = 0; i < lights.size(); i++) {
+				glm::vec2 source = lights[i].getSource();
+				renderer.drawLight(&lights[i]);
+				renderer.drawLightMask(source, source + glm::vec2(BENCHMARK_UNIT, 0.0f), source + glm::vec2(0.0f, BENCHMARK_UNIT), lights[i].getColor());
+			}
+
+			renderer.end();
+
+			totalTime += Profiler::now() - start;
+			total.drawCalls += backend.getStatistics().drawCalls;
+			total.stateChanges += backend.getStatistics().stateChanges;
+			total.uploadedBytes += backend.getStatistics().uploadedBytes;
+		}
+
+		std::cout << "Renderer benchmark, " << frames << " frames" << std::endl;
+		std::cout << "CPU ms/frame: " << totalTime / NANOSECONDS_PER_MILISECOND / frames << std::endl;
+		std::cout << "Draw calls/frame: " << (double)total.drawCalls / frames << std::endl;
+		std::cout << "State changes/frame: " << (double)total.stateChanges / frames << std::endl;
+		std::cout << "Uploaded bytes/frame: " << total.uploadedBytes / frames << std::endl;
+	}
+
+	// cached state holds names of the null backend, the next backend starts from nothing
+	GLState::invalidate();
+	GraphicsBackend::set(nullptr);
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#define BENCHMARK_FRAMES 600
+#define BENCHMARK_LIGHTS 8
+#define BENCHMARK_UNIT 60.0f
+
+// Runs the renderer headless against NullBackend. Every frame submits a screen of squares,
+// textured rectangles, light masks and lights, like the game does, then prints the average
+// CPU time of begin / end and the draw calls, state changes and bytes NullBackend counted.
+// It needs no window or GL context, but it must run before anything created GL objects.
+class RendererBenchmark
+{
+public:
+	// run
+	static void run(int screenWidth, int screenHeight, int frames = BENCHMARK_FRAMES);
+};
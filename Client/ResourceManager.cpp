@@ -2,6 +2,10 @@
 
 TextureCache ResourceManager::textureCache;
 
-GLTexture ResourceManager::getTexture(std::string texturePath) {
-	return textureCache.getTexture(texturePath);
+GLTexture ResourceManager::getTexture(std::string texturePath, TextureUsage usage) {
+	return textureCache.getTexture(texturePath, usage);
+}
+
+void ResourceManager::finalizeTextures() {
+	textureCache.finalize();
 }
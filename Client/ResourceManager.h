@@ -7,7 +7,8 @@ private:
 	static TextureCache textureCache;
 
 public:
-	static GLTexture getTexture(std::string texturePath);
+	static GLTexture getTexture(std::string texturePath, TextureUsage usage = TextureUsage::ALL);
+	static void finalizeTextures();
 
 };
 
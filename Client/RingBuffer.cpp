@@ -0,0 +1,204 @@
+#include "RingBuffer.h"
+#include "GLState.h"
+#include "SDLException.h"
+#include "GraphicsBackend.h"
+
+RingBuffer::RingBuffer() : bufferID(0), fences(), mappedData(nullptr), sectionData(nullptr), stride(0), capacity(0), section(0), size(0), persistent(false), resized(false) {
+
+}
+
+// init
+void RingBuffer::init(GLsizei stride, int capacity) {
+	if (check()) {
+		this->stride = stride;
+		this->capacity = capacity;
+
+		// ARB_buffer_storage lets us keep the buffer mapped, otherwise every frame maps its own section
+		persistent = GLEW_ARB_buffer_storage;
+
+		createBuffer();
+	}
+}
+
+void RingBuffer::createBuffer() {
+	GLsizeiptr bufferSize = (GLsizeiptr)stride * capacity * RING_BUFFER_SECTIONS;
+
+	GraphicsBackend::get().genBuffers(1, &bufferID);
+	GLState::bindBuffer(GL_ARRAY_BUFFER, bufferID);
+
+	if (persistent) {
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		// immutable storage, mapped once for the whole lifetime of the buffer
+		GraphicsBackend::get().bufferStorage(GL_ARRAY_BUFFER, bufferSize, nullptr, flags);
+		mappedData = (GLubyte*)GraphicsBackend::get().mapBufferRange(GL_ARRAY_BUFFER, 0, bufferSize, flags);
+
+		if (mappedData == nullptr) {
+			throw SDLException(BUFFER_MAP_ERROR);
+		}
+	}
+	else {
+		GraphicsBackend::get().bufferData(GL_ARRAY_BUFFER, bufferSize, nullptr, GL_STREAM_DRAW);
+	}
+
+	GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// begin / end
+void RingBuffer::begin() {
+	// move to the next section and make sure GPU is done reading from it
+	section = (section + 1) % RING_BUFFER_SECTIONS;
+	waitFence(section);
+
+	size = 0;
+	resized = false;
+
+	map();
+}
+
+void RingBuffer::end() {
+	unmap();
+}
+
+void RingBuffer::fence() {
+	// must be called after the last draw call which reads from the current section
+	if (fences[section] != nullptr) {
+		GraphicsBackend::get().deleteSync(fences[section]);
+	}
+	fences[section] = GraphicsBackend::get().fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+// allocate
+void* RingBuffer::allocate(int count) {
+	if (size + count > capacity) {
+		grow(size + count);
+	}
+
+	void* data = sectionData + (size_t)size * stride;
+	size = size + count;
+
+	return data;
+}
+
+void RingBuffer::grow(int count) {
+	GLuint oldBufferID = bufferID;
+	GLintptr oldOffset = (GLintptr)section * capacity * stride;
+
+	// whole buffer is going to be replaced, wait until GPU is done with every section
+	unmap();
+	waitFences();
+
+	if (persistent) {
+		GLState::bindBuffer(GL_ARRAY_BUFFER, oldBufferID);
+		GraphicsBackend::get().unmapBuffer(GL_ARRAY_BUFFER);
+		GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	while (capacity < count) {
+		capacity = capacity * 2;
+	}
+
+	createBuffer();
+
+	// copy vertices which were already written in this frame
+	if (size > 0) {
+		GLState::bindBuffer(GL_COPY_READ_BUFFER, oldBufferID);
+		GLState::bindBuffer(GL_COPY_WRITE_BUFFER, bufferID);
+		GraphicsBackend::get().copyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, oldOffset, 0, (GLsizeiptr)size * stride);
+		GLState::bindBuffer(GL_COPY_READ_BUFFER, 0);
+		GLState::bindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	}
+
+	GLState::deleteBuffer(oldBufferID);
+
+	// vertex arrays still point to the old buffer
+	section = 0;
+	resized = true;
+
+	map();
+}
+
+// map / unmap
+void RingBuffer::map() {
+	if (persistent) {
+		sectionData = mappedData + (size_t)section * capacity * stride;
+		return;
+	}
+
+	GLState::bindBuffer(GL_ARRAY_BUFFER, bufferID);
+
+	// section is already protected by its fence, so the driver does not have to synchronize
+	GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+	sectionData = (GLubyte*)GraphicsBackend::get().mapBufferRange(GL_ARRAY_BUFFER, (GLintptr)section * capacity * stride, (GLsizeiptr)capacity * stride, flags);
+
+	GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
+
+	if (sectionData == nullptr) {
+		throw SDLException(BUFFER_MAP_ERROR);
+	}
+}
+
+void RingBuffer::unmap() {
+	if (persistent || sectionData == nullptr) {
+		return;
+	}
+
+	GLState::bindBuffer(GL_ARRAY_BUFFER, bufferID);
+	GraphicsBackend::get().unmapBuffer(GL_ARRAY_BUFFER);
+	GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
+
+	sectionData = nullptr;
+}
+
+// fences
+void RingBuffer::waitFence(int section) {
+	GLsync fence = fences[section];
+
+	if (fence == nullptr) {
+		return;
+	}
+
+	GLenum result = GraphicsBackend::get().clientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT);
+	while (result == GL_TIMEOUT_EXPIRED) {
+		result = GraphicsBackend::get().clientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT);
+	}
+
+	GraphicsBackend::get().deleteSync(fence);
+	fences[section] = nullptr;
+}
+
+void RingBuffer::waitFences() {
+	for (int i = 0; i < RING_BUFFER_SECTIONS; i++) {
+		waitFence(i);
+	}
+}
+
+// getters
+GLuint RingBuffer::getBufferID() const {
+	return bufferID;
+}
+
+GLsizei RingBuffer::getStride() const {
+	return stride;
+}
+
+int RingBuffer::getSize() const {
+	return size;
+}
+
+int RingBuffer::getCapacity() const {
+	return capacity;
+}
+
+int RingBuffer::getBaseVertex() const {
+	return section * capacity;
+}
+
+bool RingBuffer::isResized() const {
+	return resized;
+}
+
+// helper
+bool RingBuffer::check() {
+	return bufferID == 0;
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "VertexStream.h"
+#include <GL/glew.h>
+
+#define RING_BUFFER_SECTIONS 3
+#define RING_BUFFER_CAPACITY 65536
+#define FENCE_TIMEOUT 1000000000
+
+// Streaming vertex buffer split into RING_BUFFER_SECTIONS sections, one per frame in flight.
+// Vertices are written straight into mapped memory, fences keep the CPU from overwriting
+// a section the GPU is still reading from.
+class RingBuffer : public VertexStream
+{
+private:
+	GLuint bufferID;
+	GLsync fences[RING_BUFFER_SECTIONS];
+	GLubyte* mappedData;
+	GLubyte* sectionData;
+	GLsizei stride;
+	int capacity;
+	int section;
+	int size;
+	bool persistent;
+	bool resized;
+public:
+	// constructors
+	RingBuffer();
+
+	// init
+	void init(GLsizei stride, int capacity = RING_BUFFER_CAPACITY);
+
+	// begin / end
+	void begin();
+	void end();
+	void fence();
+
+	// allocate
+	void* allocate(int count) override;
+
+	// getters
+	GLuint getBufferID() const;
+	GLsizei getStride() const;
+	int getSize() const override;
+	int getCapacity() const;
+	int getBaseVertex() const;
+	bool isResized() const;
+private:
+	// buffer
+	void createBuffer();
+	void grow(int count);
+
+	// map / unmap
+	void map();
+	void unmap();
+
+	// fences
+	void waitFence(int section);
+	void waitFences();
+
+	// helper
+	bool check();
+};
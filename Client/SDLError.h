@@ -16,4 +16,9 @@ static const std::string FRAGMENT_ERROR_1 = "Failed to create fragment shader.";
 static const std::string FRAGMENT_ERROR_2 = "Failed to open fragment shader file.";
 static const std::string FRAGMENT_ERROR_3 = "Failed to compile vertex shader.";
 
-static const std::string UNIFORM_VALUE_ERRROR = "Uniform value with given name not found: ";
\ No newline at end of file
+static const std::string UNIFORM_VALUE_ERRROR = "Uniform value with given name not found: ";
+static const std::string UNIFORM_BLOCK_ERROR = "Uniform block with given name not found: ";
+
+// buffer errors
+static const std::string BUFFER_MAP_ERROR = "Failed to map vertex buffer.";
+static const std::string FRAMEBUFFER_ERROR = "Failed to create framebuffer.";
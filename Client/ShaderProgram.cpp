@@ -1,20 +1,18 @@
 #include "ShaderProgram.h"
+#include "GLState.h"
 #include "SDLException.h"
 #include "EngineConfig.h"
+#include "CameraBuffer.h"
+#include "GraphicsBackend.h"
 #include <fstream>
 #include <iostream>
 #include <vector>
 
-ShaderProgram::ShaderProgram() : numAttributes(0), programID(0), vertexShaderID(0), fragmenShaderID(0), cameraMatrix(nullptr) {
+ShaderProgram::ShaderProgram() : numAttributes(0), programID(0), vertexShaderID(0), fragmenShaderID(0) {
 
 }
 
-ShaderProgram::ShaderProgram(Camera2D& camera, std::string vertexPath, std::string fragmenPath) : numAttributes(0), programID(0), vertexShaderID(0), fragmenShaderID(0), cameraMatrix(nullptr) {
-	initShaders(camera, vertexPath, fragmenPath);
-}
-
-void ShaderProgram::initShaders(Camera2D& camera, std::string vertexPath, std::string fragmenPath) {
-	setCamera(camera);
+ShaderProgram::ShaderProgram(std::string vertexPath, std::string fragmenPath) : numAttributes(0), programID(0), vertexShaderID(0), fragmenShaderID(0) {
 	init(vertexPath, fragmenPath);
 }
 
@@ -28,7 +26,7 @@ void ShaderProgram::init(std::string vertexPath, std::string fragmenPath) {
 
 void ShaderProgram::createProgram() {
 	// create program
-	programID = glCreateProgram();
+	programID = GraphicsBackend::get().createProgram();
 }
 
 void ShaderProgram::createShaders() {
@@ -42,13 +40,13 @@ void ShaderProgram::createShader(GLenum shaderType) {
 	switch (shaderType) {
 	case GL_VERTEX_SHADER: {
 		// check for errors
-		if ((vertexShaderID = glCreateShader(shaderType)) == 0) {
+		if ((vertexShaderID = GraphicsBackend::get().createShader(shaderType)) == 0) {
 			throw SDLException(VERTEX_ERROR_1);
 		}
 	}
 	case GL_FRAGMENT_SHADER: {
 		// check for errors
-		if ((fragmenShaderID = glCreateShader(shaderType)) == 0) {
+		if ((fragmenShaderID = GraphicsBackend::get().createShader(shaderType)) == 0) {
 			throw SDLException(FRAGMENT_ERROR_1);
 		}
 		break;
@@ -72,22 +70,22 @@ void ShaderProgram::compileShader(GLuint shaderID, const std::string& shaderFile
 	const char* dataArray = vertexData.c_str();
 
 	// prepare for compilation
-	glShaderSource(shaderID, 1, &dataArray, nullptr);
+	GraphicsBackend::get().shaderSource(shaderID, 1, &dataArray, nullptr);
 
 	// compile shader
-	glCompileShader(shaderID);
+	GraphicsBackend::get().compileShader(shaderID);
 
 	// check for compilation errors
 	GLint status = 0;
-	glGetShaderiv(shaderID, GL_COMPILE_STATUS, &status);
+	GraphicsBackend::get().getShaderiv(shaderID, GL_COMPILE_STATUS, &status);
 
 	if (status == GL_FALSE) {
 		GLint infoLength = 0;
-		glGetShaderiv(shaderID, GL_INFO_LOG_LENGTH, &infoLength);
+		GraphicsBackend::get().getShaderiv(shaderID, GL_INFO_LOG_LENGTH, &infoLength);
 
 		// get error log
 		std::vector<GLchar> errorLog(infoLength);
-		glGetShaderInfoLog(shaderID, infoLength, &infoLength, &errorLog[0]);
+		GraphicsBackend::get().getShaderInfoLog(shaderID, infoLength, &infoLength, &errorLog[0]);
 
 		// determine shader type
 		std::string vertexType;
@@ -108,7 +106,7 @@ void ShaderProgram::compileShader(GLuint shaderID, const std::string& shaderFile
 		std::string error(&errorLog[0]);
 
 		// delete shader
-		glDeleteShader(shaderID);
+		GraphicsBackend::get().deleteShader(shaderID);
 
 		throw SDLException(vertexType + error);
 	}
@@ -158,23 +156,23 @@ void ShaderProgram::linkShaders() {
 	// Now time to link them together into a program.
 
 	// attach shaders to program
-	glAttachShader(programID, vertexShaderID);
-	glAttachShader(programID, fragmenShaderID);
+	GraphicsBackend::get().attachShader(programID, vertexShaderID);
+	GraphicsBackend::get().attachShader(programID, fragmenShaderID);
 
 	// link program
-	glLinkProgram(programID);
+	GraphicsBackend::get().linkProgram(programID);
 
 	// check for erros
 	GLint status = 0;
-	glGetProgramiv(programID, GL_LINK_STATUS, &status);
+	GraphicsBackend::get().getProgramiv(programID, GL_LINK_STATUS, &status);
 
 	if (status == GL_FALSE) {
 		GLint infoLength = 0;
-		glGetProgramiv(programID, GL_INFO_LOG_LENGTH, &infoLength);
+		GraphicsBackend::get().getProgramiv(programID, GL_INFO_LOG_LENGTH, &infoLength);
 
 		// get error log
 		std::vector<GLchar> errorLog(infoLength);
-		glGetShaderInfoLog(programID, infoLength, &infoLength, &errorLog[0]);
+		GraphicsBackend::get().getShaderInfoLog(programID, infoLength, &infoLength, &errorLog[0]);
 
 		// create error log
 		std::string error(&errorLog[0]);
@@ -184,56 +182,84 @@ void ShaderProgram::linkShaders() {
 	}
 
 	// detach shaders from program
-	glDetachShader(programID, vertexShaderID);
-	glDetachShader(programID, fragmenShaderID);
+	GraphicsBackend::get().detachShader(programID, vertexShaderID);
+	GraphicsBackend::get().detachShader(programID, fragmenShaderID);
 
 	// delete shaders
-	glDeleteShader(vertexShaderID);
-	glDeleteShader(fragmenShaderID);
-}
+	GraphicsBackend::get().deleteShader(vertexShaderID);
+	GraphicsBackend::get().deleteShader(fragmenShaderID);
 
-void ShaderProgram::addAttribute(const std::string& attributeName) {
-	glBindAttribLocation(programID, numAttributes++, attributeName.c_str());
+	// uniforms are looked up once, camera comes from the shared camera buffer
+	reflectUniforms();
+	bindCameraBlock();
 }
 
-GLint ShaderProgram::getUniformValueLocation(const std::string& uniformValueName) {
-	GLint location = glGetUniformLocation(programID, uniformValueName.c_str());
-	// check for errors
-	if (location == GL_INVALID_INDEX) {
-		throw SDLException(UNIFORM_VALUE_ERRROR + uniformValueName + ".");
-	}
-	return location;
-}
+void ShaderProgram::reflectUniforms() {
+	GLint uniformNumber = 0;
+	GraphicsBackend::get().getProgramiv(programID, GL_ACTIVE_UNIFORMS, &uniformNumber);
 
-void ShaderProgram::use() {
-	// use program
-	glUseProgram(programID);
+	GLint maxLength = 0;
+	GraphicsBackend::get().getProgramiv(programID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+	std::vector<GLchar> nameBuffer(maxLength + 1);
+	uniformLocations.clear();
 
-	// enable attributes
-	for (int i = 0; i < numAttributes; i++) {
-		glEnableVertexAttribArray(i);
+	for (GLint i = 0; i < uniformNumber; i++) {
+		GLsizei length = 0;
+		GLint size = 0;
+		GLenum type = 0;
+		GraphicsBackend::get().getActiveUniform(programID, i, (GLsizei)nameBuffer.size(), &length, &size, &type, &nameBuffer[0]);
+
+		std::string name(&nameBuffer[0], length);
+		GLint location = GraphicsBackend::get().getUniformLocation(programID, name.c_str());
+
+		// members of uniform blocks have no location
+		if (location == -1) {
+			continue;
+		}
+
+		// arrays are reported as name[0], but can be looked up by name too
+		size_t bracket = name.find('[');
+		if (bracket != std::string::npos) {
+			uniformLocations[name.substr(0, bracket)] = location;
+		}
+
+		uniformLocations[name] = location;
 	}
+}
 
-	// upload camera
-	uploadCameraMatrix();
+void ShaderProgram::bindCameraBlock() {
+	GLuint blockIndex = GraphicsBackend::get().getUniformBlockIndex(programID, CAMERA_BLOCK_NAME);
+	if (blockIndex != GL_INVALID_INDEX) {
+		GraphicsBackend::get().uniformBlockBinding(programID, blockIndex, CAMERA_BLOCK_BINDING);
+	}
 }
 
-void ShaderProgram::unuse() {
-	// unuse program, 0 means no program
-	glUseProgram(0);
+void ShaderProgram::addAttribute(const std::string& attributeName) {
+	GraphicsBackend::get().bindAttribLocation(programID, numAttributes++, attributeName.c_str());
+}
 
-	// disable attributes
-	for (int i = 0; i < numAttributes; i++) {
-		glDisableVertexAttribArray(i);
+GLint ShaderProgram::getUniformValueLocation(const std::string& uniformValueName) {
+	auto it = uniformLocations.find(uniformValueName);
+	// check for errors
+	if (it == uniformLocations.end()) {
+		throw SDLException(UNIFORM_VALUE_ERRROR + uniformValueName + ".");
 	}
+	return it->second;
 }
 
-void ShaderProgram::uploadCameraMatrix() {
-	glUniformMatrix4fv(getUniformValueLocation("cameraMatrix"), 1, GL_FALSE, &(*cameraMatrix)[0][0]);
+void ShaderProgram::bindUniformBlock(const std::string& blockName, GLuint binding) {
+	GLuint blockIndex = GraphicsBackend::get().getUniformBlockIndex(programID, blockName.c_str());
+	// check for errors
+	if (blockIndex == GL_INVALID_INDEX) {
+		throw SDLException(UNIFORM_BLOCK_ERROR + blockName + ".");
+	}
+	GraphicsBackend::get().uniformBlockBinding(programID, blockIndex, binding);
 }
 
-void ShaderProgram::setCamera(Camera2D& camera) {
-	cameraMatrix = &camera.getCameraReference();
+void ShaderProgram::use() {
+	// use program, attributes are enabled in vertex arrays
+	GLState::useProgram(programID);
 }
 
 bool ShaderProgram::check() {
@@ -1,6 +1,6 @@
 #pragma once
-#include "Camera2D.h"
 #include <string>
+#include <unordered_map>
 #include <GL/glew.h>
 #include <glm/glm.hpp>
 class ShaderProgram
@@ -10,26 +10,25 @@ private:
 	GLuint programID;
 	GLuint vertexShaderID;
 	GLuint fragmenShaderID;
-	glm::mat4* cameraMatrix;
+	std::unordered_map<std::string, GLint> uniformLocations;
 public:
 	ShaderProgram();
-	ShaderProgram(Camera2D& camera, std::string vertexPath, std::string fragmenPath);
+	ShaderProgram(std::string vertexPath, std::string fragmenPath);
 	void init(std::string vertexPath, std::string fragmenPath);
-	void initShaders(Camera2D& camera, std::string vertexPath, std::string fragmenPath);
 	void addAttribute(const std::string& attributeName);
 	GLint getUniformValueLocation(const std::string& uniformValueName);
+	void bindUniformBlock(const std::string& blockName, GLuint binding);
 	void linkShaders();
 	void use();
-	void unuse();
 private:
 	void createProgram();
 	void createShaders();
 	void createShader(GLenum shaderType);
 	void compileShaders(const std::string& vertexShaderFile, const std::string& fragmentShaderFile);
 	void compileShader(GLuint shaderID, const std::string& shaderFile, GLenum shaderType);
-	void uploadCameraMatrix();
+	void reflectUniforms();
+	void bindCameraBlock();
 	void throwFileError(GLenum shaderType);
-	void setCamera(Camera2D& camera);
 	bool check();
 	std::string getFileData(const std::string& filePath, GLenum shaderType);
 };
@@ -1,170 +1,210 @@
 #include "SpriteBatch.h"
+#include "GLState.h"
+#include "ThreadPool.h"
+#include "GraphicsBackend.h"
+#include "Counters.h"
+#include "AllocationTracker.h"
 #include <algorithm>
 
-SpriteBatch::SpriteBatch() : vertexBufferID(0), vertexArrayID(0), sortType(GlyphSortType::NONE) {
+static Counter batchedGlyphs("SpriteBatch glyphs");
+static Counter renderBatchCount("SpriteBatch batches");
+
+SpriteBatch::SpriteBatch() : vertexArrayID(0), vertexFormat(VertexFormat::createVertex()), vertexBuffer(), sortType(GlyphSortType::NONE) {
 
 }
 
 void SpriteBatch::init() {
+	vertexBuffer.init(vertexFormat.getStride());
 	createVertexArray();
 }
 
 void SpriteBatch::createRenderBatches() {
-	if (glyphs.empty()) {
+	if (glyphs.isEmpty()) {
 		return;
 	}
 
-	// vertex array
-	std::vector<Vertex> vertices;
+	int glyphNumber = glyphs.getSize();
+
+	// vertices are written straight into the mapped section of the vertex buffer
+	vertexBuffer.begin();
+	Vertex* vertices = (Vertex*)vertexBuffer.allocate(glyphNumber * GLYPH_VERTICES);
 
-	// allocate all the memory we need for our array
-	vertices.resize(glyphs.size() * 6);
+	// every chunk expands its own range of sorted glyphs into a disjoint part of the buffer
+	int chunkNumber = (glyphNumber + GLYPH_CHUNK_SIZE - 1) / GLYPH_CHUNK_SIZE;
+	int chunkSize = (glyphNumber + chunkNumber - 1) / chunkNumber;
+
+	if ((int)chunkBatches.size() < chunkNumber) {
+		chunkBatches.resize(chunkNumber);
+	}
 
-	// instead of resizing vector we can reserve memory to fit our needs
-	//vertices.reserve(glyphs.size() * 6);
+	ThreadPool::run(chunkNumber, [&](int chunk) {
+		int first = chunk * chunkSize;
+		int last = std::min(first + chunkSize, glyphNumber);
+		createChunkBatches(first, last, vertices + (size_t)first * GLYPH_VERTICES, chunkBatches[chunk]);
+	});
 
-	int offset = 0;
-	int index = 0;
+	stitchRenderBatches(chunkNumber);
 
-	// creates object of defined type with given values
-	renderBatches.emplace_back(0, 6, glyphs[0]->texture);
+	vertexBuffer.end();
+
+	// buffer was replaced while allocating, vertex array has to point to the new one
+	if (vertexBuffer.isResized()) {
+		bindVertexAttributes();
+	}
+}
 
-	vertices[index++] = glyphs[0]->topLeft;
-	vertices[index++] = glyphs[0]->topRight;
-	vertices[index++] = glyphs[0]->bottomLeft;
-	vertices[index++] = glyphs[0]->bottomLeft;
-	vertices[index++] = glyphs[0]->bottomRight;
-	vertices[index++] = glyphs[0]->topRight;
-	offset += 6;
-	
+void SpriteBatch::createChunkBatches(int first, int last, Vertex* vertices, std::vector<RenderBatch>& batches) {
+	GLuint offset = first * GLYPH_VERTICES;
+	GLuint texture = 0;
 
-	for (int i = 1; i < glyphs.size(); i++) {
-		if (glyphs[i]->texture != glyphs[i - 1]->texture) {
-			renderBatches.emplace_back(offset, 6, glyphs[i]->texture);
+	batches.clear();
+
+	for (int i = first; i < last; i++) {
+		const Glyph& glyph = glyphs.get(i);
+
+		if (i == first || glyph.texture != texture) {
+			batches.emplace_back(offset, GLYPH_VERTICES, glyph.texture);
+			texture = glyph.texture;
 		}
 		else {
-			renderBatches.back().numVertices += 6;
+			batches.back().numVertices += GLYPH_VERTICES;
 		}
-		vertices[index++] = glyphs[i]->topLeft;
-		vertices[index++] = glyphs[i]->topRight;
-		vertices[index++] = glyphs[i]->bottomLeft;
-		vertices[index++] = glyphs[i]->bottomLeft;
-		vertices[index++] = glyphs[i]->bottomRight;
-		vertices[index++] = glyphs[i]->topRight;
-		offset += 6;
-	}
 
-	glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID);
+		vertices[0] = glyph.topLeft;
+		vertices[1] = glyph.topRight;
+		vertices[2] = glyph.bottomLeft;
+		vertices[3] = glyph.bottomLeft;
+		vertices[4] = glyph.bottomRight;
+		vertices[5] = glyph.topRight;
 
-	// orphan the buffer
-	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), nullptr, GL_DYNAMIC_DRAW);
-
-	// upload the data
-	glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(Vertex), vertices.data());
+		vertices = vertices + GLYPH_VERTICES;
+		offset = offset + GLYPH_VERTICES;
+	}
+}
 
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+void SpriteBatch::stitchRenderBatches(int chunkNumber) {
+	for (int i = 0; i < chunkNumber; i++) {
+		const std::vector<RenderBatch>& batches = chunkBatches[i];
+
+		for (size_t j = 0; j < batches.size(); j++) {
+			// chunk can start with the same texture the previous one ended with
+			if (j == 0 && !renderBatches.empty() && renderBatches.back().texture == batches[j].texture) {
+				renderBatches.back().numVertices += batches[j].numVertices;
+			}
+			else {
+				renderBatches.push_back(batches[j]);
+			}
+		}
+	}
 }
 
 void SpriteBatch::createVertexArray() {
 	if (vertexArrayID == 0) {
-		glGenVertexArrays(1, &vertexArrayID);
+		GraphicsBackend::get().genVertexArrays(1, &vertexArrayID);
 	}
 
-	glBindVertexArray(vertexArrayID);
-	
-	if (vertexBufferID == 0) {
-		glGenBuffers(1, &vertexBufferID);
-	}
+	GLState::bindVertexArray(vertexArrayID);
 
-	// whenever we rebind VertexArray automatically bind buffer below
-	glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID);
+	vertexFormat.enableAttributes();
 
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+	// automatically disable anything what was enabled above
+	GLState::bindVertexArray(0);
 
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+	bindVertexAttributes();
+}
 
-	glEnableVertexAttribArray(2);
-	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, uv));
+void SpriteBatch::bindVertexAttributes() {
+	GLState::bindVertexArray(vertexArrayID);
 
-	// automatically disable anything what was enabled above
-	glBindVertexArray(0);
+	// whenever we rebind VertexArray automatically bind buffer below
+	GLState::bindBuffer(GL_ARRAY_BUFFER, vertexBuffer.getBufferID());
+
+	vertexFormat.bindAttributes();
+
+	GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
+	GLState::bindVertexArray(0);
 }
 
 void SpriteBatch::begin(GlyphSortType sortType) {
 	this->sortType = sortType;
+
+	// clear keeps capacity, so glyphs are not allocated again every frame
 	renderBatches.clear();
 	glyphs.clear();
 }
 
 void SpriteBatch::end() {
+	MEMORY_SCOPE(MemoryTag::SPRITES);
 	sortGlyphs();
 	createRenderBatches();
+
+	batchedGlyphs.add(glyphs.getSize());
+	renderBatchCount.add((long long)renderBatches.size());
 }
 
 void SpriteBatch::sortGlyphs() {
-	// elements with the same value are in the same order
-	switch (sortType)
-	{
-	case GlyphSortType::FRONT_TO_BACK:
-		std::stable_sort(glyphs.begin(), glyphs.end(), compareFrontToBack);
-		break;
-	case GlyphSortType::BACK_TO_FRONT:
-		std::stable_sort(glyphs.begin(), glyphs.end(), compareBackToFront);
-		break;
-	case GlyphSortType::TEXTURE:
-		std::stable_sort(glyphs.begin(), glyphs.end(), compareTexture);
-		break;
-	default:
-		break;
+	// radix sort is stable, elements with the same key stay in the order they were drawn
+	if (sortType != GlyphSortType::NONE) {
+		glyphs.sort();
 	}
 }
 
-bool SpriteBatch::compareFrontToBack(Glyph* a, Glyph* b) {
-	return (a->depth < b->depth);
-}
-
-bool SpriteBatch::compareBackToFront(Glyph* a, Glyph* b) {
-	return (a->depth > b->depth);
-}
-
-bool SpriteBatch::compareTexture(Glyph* a, Glyph* b) {
-	return (a->texture < b->texture);
-}
-
 void SpriteBatch::draw(const glm::vec4& destRect, const glm::vec4& uvRect, float depth, const GLuint& texture, const Color& color) {
-	Glyph* glyph = new Glyph();
-	glyph->texture = texture;
-	glyph->depth = depth;
+	MEMORY_SCOPE(MemoryTag::SPRITES);
+	Glyph glyph;
+	glyph.texture = texture;
+	glyph.depth = depth;
 
-	glyph->topLeft.color = color;
-	glyph->topLeft.setPosition(destRect.x, destRect.y + destRect.w);
-	glyph->topLeft.setUV(uvRect.x, uvRect.y + uvRect.w);
+	glyph.topLeft.color = color;
+	glyph.topLeft.setPosition(destRect.x, destRect.y + destRect.w);
+	glyph.topLeft.setUV(uvRect.x, uvRect.y + uvRect.w);
 
-	glyph->bottomLeft.color = color;
-	glyph->bottomLeft.setPosition(destRect.x, destRect.y);
-	glyph->bottomLeft.setUV(uvRect.x, uvRect.y);
+	glyph.bottomLeft.color = color;
+	glyph.bottomLeft.setPosition(destRect.x, destRect.y);
+	glyph.bottomLeft.setUV(uvRect.x, uvRect.y);
 
-	glyph->topRight.color = color;
-	glyph->topRight.setPosition(destRect.x + destRect.z, destRect.y + destRect.w);
-	glyph->topRight.setUV(uvRect.x + uvRect.z, uvRect.y + uvRect.w);
+	glyph.topRight.color = color;
+	glyph.topRight.setPosition(destRect.x + destRect.z, destRect.y + destRect.w);
+	glyph.topRight.setUV(uvRect.x + uvRect.z, uvRect.y + uvRect.w);
 
-	glyph->bottomRight.color = color;
-	glyph->bottomRight.setPosition(destRect.x + destRect.z, destRect.y);
-	glyph->bottomRight.setUV(uvRect.x + uvRect.z, uvRect.y);
+	glyph.bottomRight.color = color;
+	glyph.bottomRight.setPosition(destRect.x + destRect.z, destRect.y);
+	glyph.bottomRight.setUV(uvRect.x + uvRect.z, uvRect.y);
 
-	glyphs.push_back(glyph);
+	glyphs.add(createKey(texture, depth), glyph);
 }
 
 void SpriteBatch::renderBatch() {
-	glBindVertexArray(vertexArrayID);
-	for (int i = 0; i < renderBatches.size(); i++) {
-		glBindTexture(GL_TEXTURE_2D, renderBatches[i].texture);
+	if (renderBatches.empty()) {
+		return;
+	}
 
-		glDrawArrays(GL_TRIANGLES, renderBatches[i].offset, renderBatches[i].numVertices);
+	GLint baseVertex = vertexBuffer.getBaseVertex();
+
+	GLState::bindVertexArray(vertexArrayID);
+	for (size_t i = 0; i < renderBatches.size(); i++) {
+		GLState::bindTexture(GL_TEXTURE_2D, renderBatches[i].texture);
+
+		GraphicsBackend::get().drawArrays(GL_TRIANGLES, baseVertex + renderBatches[i].offset, renderBatches[i].numVertices);
 	}
-	glBindVertexArray(0);
-}
+	GLState::bindVertexArray(0);
 
+	// section can't be written again until GPU is done with these draws
+	vertexBuffer.fence();
+}
 
+// helper
+unsigned long long SpriteBatch::createKey(GLuint texture, float depth) {
+	// same key layout as Renderer, only texture and depth fields are used
+	switch (sortType)
+	{
+	case GlyphSortType::FRONT_TO_BACK:
+		return RenderKey::create(0, 0, 0, 0, 0, RenderKey::createDepth(depth));
+	case GlyphSortType::BACK_TO_FRONT:
+		return RenderKey::create(0, 0, 0, 0, 0, ~RenderKey::createDepth(depth));
+	case GlyphSortType::TEXTURE:
+		return RenderKey::create(0, 0, 0, 0, texture, 0);
+	default:
+		return 0;
+	}
+}
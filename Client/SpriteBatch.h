@@ -1,9 +1,15 @@
 #pragma once
 #include <GL/glew.h>
 #include "Vertex.h"
+#include "RingBuffer.h"
+#include "VertexFormat.h"
+#include "RenderQueue.h"
 #include <glm/glm.hpp>
 #include <vector>
 
+#define GLYPH_VERTICES 6
+#define GLYPH_CHUNK_SIZE 4096
+
 enum class GlyphSortType {
 	NONE,
 	FRONT_TO_BACK,
@@ -32,13 +38,18 @@ public:
 class SpriteBatch
 {
 private:
-	GLuint vertexBufferID;
 	GLuint vertexArrayID;
+	VertexFormat vertexFormat;
+	RingBuffer vertexBuffer;
 	GlyphSortType sortType;
 
-	std::vector<Glyph*> glyphs;
+	// glyphs are kept by value, memory is reused from frame to frame
+	RenderQueue<Glyph> glyphs;
 	std::vector<RenderBatch> renderBatches;
 
+	// batches found by every chunk of glyphs, stitched together after expansion
+	std::vector<std::vector<RenderBatch>> chunkBatches;
+
 public:
 	SpriteBatch();
 
@@ -50,11 +61,12 @@ public:
 
 private:
 	void createRenderBatches();
+	void createChunkBatches(int first, int last, Vertex* vertices, std::vector<RenderBatch>& batches);
+	void stitchRenderBatches(int chunkNumber);
 	void createVertexArray();
+	void bindVertexAttributes();
 	void sortGlyphs();
 
-	static bool compareFrontToBack(Glyph* a, Glyph* b);
-	static bool compareBackToFront(Glyph* a, Glyph* b);
-	static bool compareTexture(Glyph* a, Glyph* b);
+	// helper
+	unsigned long long createKey(GLuint texture, float depth);
 };
-
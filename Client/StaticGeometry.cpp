@@ -0,0 +1,178 @@
+#include "StaticGeometry.h"
+#include "GLState.h"
+#include "Collision.h"
+#include "GraphicsBackend.h"
+#include <glm/glm.hpp>
+
+StaticGeometry::StaticGeometry() : vertexArrayID(0), bufferID(0), vertexFormat(VertexFormat::createStaticVertex()), origin(0.0f), extent(1.0f) {
+
+}
+
+// add
+void StaticGeometry::addSquare(float x, float y, float width, float height, Color color) {
+	StaticChunk& chunk = getChunk(x, y);
+
+	// chunk bounds grow with squares which cross the chunk border
+	Square bounds = chunk.bounds;
+	if (chunk.quadNumber == 0) {
+		bounds = Square(x, y, width, height);
+	}
+	else {
+		float minX = glm::min(bounds.getX(), x);
+		float minY = glm::min(bounds.getY(), y);
+		float maxX = glm::max(bounds.getX() + bounds.getWidth(), x + width);
+		float maxY = glm::max(bounds.getY() + bounds.getHeight(), y + height);
+		bounds = Square(minX, minY, maxX - minX, maxY - minY);
+	}
+	chunk.bounds = bounds;
+
+	// same corner order as GLSL_Square, see QuadIndexBuffer
+	chunk.vertices.emplace_back(x + width, y + height, color);
+	chunk.vertices.emplace_back(x, y + height, color);
+	chunk.vertices.emplace_back(x, y, color);
+	chunk.vertices.emplace_back(x + width, y, color);
+
+	chunk.quadNumber++;
+}
+
+// build / clear
+void StaticGeometry::build(QuadIndexBuffer& quadIndexBuffer) {
+	if (check()) {
+		GraphicsBackend::get().genVertexArrays(1, &vertexArrayID);
+		GraphicsBackend::get().genBuffers(1, &bufferID);
+	}
+
+	calculateBounds();
+
+	// chunks are stored one after another, every chunk is one draw range
+	std::vector<StaticVertex> vertices;
+	int maxQuadNumber = 0;
+
+	for (size_t i = 0; i < chunks.size(); i++) {
+		StaticChunk& chunk = chunks[i];
+
+		chunk.offset = (int)vertices.size();
+		for (size_t j = 0; j < chunk.vertices.size(); j++) {
+			vertices.push_back(quantize(chunk.vertices[j]));
+		}
+		maxQuadNumber = glm::max(maxQuadNumber, chunk.quadNumber);
+
+		// vertices live on GPU from now on
+		chunk.vertices.clear();
+		chunk.vertices.shrink_to_fit();
+	}
+
+	quadIndexBuffer.reserve(maxQuadNumber);
+
+	GLState::bindVertexArray(vertexArrayID);
+	GLState::bindBuffer(GL_ARRAY_BUFFER, bufferID);
+	GraphicsBackend::get().bufferData(GL_ARRAY_BUFFER, vertices.size() * vertexFormat.getStride(), vertices.data(), GL_STATIC_DRAW);
+
+	vertexFormat.enableAttributes();
+	vertexFormat.bindAttributes();
+
+	quadIndexBuffer.bind();
+
+	GLState::bindVertexArray(0);
+	GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void StaticGeometry::clear() {
+	chunks.clear();
+	chunkIndices.clear();
+
+	if (!check()) {
+		GLState::bindBuffer(GL_ARRAY_BUFFER, bufferID);
+		GraphicsBackend::get().bufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_STATIC_DRAW);
+		GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+}
+
+// draw
+void StaticGeometry::draw(const std::vector<Square>& areas, MultiDraw& multiDraw) const {
+	for (size_t i = 0; i < chunks.size(); i++) {
+		const StaticChunk& chunk = chunks[i];
+
+		if (isVisible(chunk, areas)) {
+			multiDraw.addElements(GL_TRIANGLES, chunk.quadNumber * QUAD_INDICES, chunk.offset);
+		}
+	}
+}
+
+// getters
+GLuint StaticGeometry::getVertexArrayID() const {
+	return vertexArrayID;
+}
+
+glm::vec2 StaticGeometry::getOrigin() const {
+	return origin;
+}
+
+glm::vec2 StaticGeometry::getExtent() const {
+	return extent;
+}
+
+int StaticGeometry::getChunkNumber() const {
+	return (int)chunks.size();
+}
+
+bool StaticGeometry::isEmpty() const {
+	return chunks.empty();
+}
+
+// helper
+StaticChunk& StaticGeometry::getChunk(float x, float y) {
+	long long chunkX = (long long)glm::floor(x / STATIC_CHUNK_SIZE);
+	long long chunkY = (long long)glm::floor(y / STATIC_CHUNK_SIZE);
+	long long key = (chunkX << 32) ^ (chunkY & 0xFFFFFFFF);
+
+	auto it = chunkIndices.find(key);
+	if (it != chunkIndices.end()) {
+		return chunks[it->second];
+	}
+
+	chunkIndices[key] = (int)chunks.size();
+	chunks.push_back(StaticChunk{ Square(), 0, 0, std::vector<ColorVertex>() });
+
+	return chunks.back();
+}
+
+void StaticGeometry::calculateBounds() {
+	if (chunks.empty()) {
+		origin = glm::vec2(0.0f);
+		extent = glm::vec2(1.0f);
+		return;
+	}
+
+	glm::vec2 min = chunks[0].bounds.getPosition();
+	glm::vec2 max = min + chunks[0].bounds.getDimensions();
+
+	for (size_t i = 1; i < chunks.size(); i++) {
+		min = glm::min(min, chunks[i].bounds.getPosition());
+		max = glm::max(max, chunks[i].bounds.getPosition() + chunks[i].bounds.getDimensions());
+	}
+
+	origin = min;
+	extent = glm::max(max - min, glm::vec2(1.0f));
+}
+
+StaticVertex StaticGeometry::quantize(const ColorVertex& vertex) const {
+	// shared corners of neighbouring squares round to the same value, so no cracks open between them
+	glm::vec2 position = (glm::vec2(vertex.position.x, vertex.position.y) - origin) / extent;
+	glm::vec2 quantized = glm::round(glm::clamp(position, 0.0f, 1.0f) * 65535.0f);
+
+	return StaticVertex((GLushort)quantized.x, (GLushort)quantized.y, vertex.color);
+}
+
+bool StaticGeometry::isVisible(const StaticChunk& chunk, const std::vector<Square>& areas) const {
+	for (size_t i = 0; i < areas.size(); i++) {
+		if (Collision::squareCollision(chunk.bounds, areas[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool StaticGeometry::check() {
+	return vertexArrayID == 0;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "Vertex.h"
+#include "Square.h"
+#include "MultiDraw.h"
+#include "QuadIndexBuffer.h"
+#include "VertexFormat.h"
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include <unordered_map>
+
+#define STATIC_CHUNK_SIZE 640.0f
+
+// squares which start inside one STATIC_CHUNK_SIZE cell, stored as one range of the static buffer
+struct StaticChunk {
+	Square bounds;
+	int offset;
+	int quadNumber;
+	std::vector<ColorVertex> vertices;
+};
+
+// Geometry which never moves (level blocks). Squares are registered once, uploaded into
+// a static buffer grouped by chunks and only visible chunks are drawn every frame.
+// Positions are stored as 16 bit fractions of the bounds of every chunk, programs which
+// draw the buffer get origin and extent of those bounds to restore them.
+class StaticGeometry
+{
+private:
+	GLuint vertexArrayID;
+	GLuint bufferID;
+	VertexFormat vertexFormat;
+	glm::vec2 origin;
+	glm::vec2 extent;
+	std::vector<StaticChunk> chunks;
+	std::unordered_map<long long, int> chunkIndices;
+public:
+	// constructors
+	StaticGeometry();
+
+	// add
+	void addSquare(float x, float y, float width, float height, Color color);
+
+	// build / clear
+	void build(QuadIndexBuffer& quadIndexBuffer);
+	void clear();
+
+	// draw
+	void draw(const std::vector<Square>& areas, MultiDraw& multiDraw) const;
+
+	// getters
+	GLuint getVertexArrayID() const;
+	glm::vec2 getOrigin() const;
+	glm::vec2 getExtent() const;
+	int getChunkNumber() const;
+	bool isEmpty() const;
+private:
+	// helper
+	StaticChunk& getChunk(float x, float y);
+	void calculateBounds();
+	StaticVertex quantize(const ColorVertex& vertex) const;
+	bool isVisible(const StaticChunk& chunk, const std::vector<Square>& areas) const;
+	bool check();
+};
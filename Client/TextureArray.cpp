@@ -0,0 +1,79 @@
+#include "TextureArray.h"
+#include "GLState.h"
+#include "GraphicsBackend.h"
+
+TextureArray::TextureArray() : textureID(0), width(0), height(0), capacity(0), size(0), mipmapped(true) {
+
+}
+
+// init
+void TextureArray::init(int width, int height, int capacity) {
+	if (check()) {
+		this->width = width;
+		this->height = height;
+		this->capacity = capacity;
+
+		GraphicsBackend::get().genTextures(1, &textureID);
+		GLState::bindTexture(GL_TEXTURE_2D_ARRAY, textureID);
+
+		// storage for every layer, layers are filled while textures are loaded
+		GraphicsBackend::get().texImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, width, height, capacity, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+		// same params as ImageLoader uses for 2D textures
+		GraphicsBackend::get().texParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		GraphicsBackend::get().texParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		GraphicsBackend::get().texParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		GraphicsBackend::get().texParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+
+		GLState::bindTexture(GL_TEXTURE_2D_ARRAY, 0);
+	}
+}
+
+// add
+int TextureArray::addLayer(const std::vector<unsigned char>& pixels) {
+	int layer = size++;
+
+	GLState::bindTexture(GL_TEXTURE_2D_ARRAY, textureID);
+	GraphicsBackend::get().texSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, &pixels[0]);
+	GLState::bindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+	// mipmaps are built for the whole array, so they wait until every layer of the batch is loaded
+	mipmapped = false;
+
+	return layer;
+}
+
+// mipmaps
+void TextureArray::generateMipmaps() {
+	if (mipmapped) {
+		return;
+	}
+
+	GLState::bindTexture(GL_TEXTURE_2D_ARRAY, textureID);
+	GraphicsBackend::get().generateMipmap(GL_TEXTURE_2D_ARRAY);
+	GLState::bindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+	mipmapped = true;
+}
+
+// getters
+GLuint TextureArray::getTextureID() const {
+	return textureID;
+}
+
+int TextureArray::getWidth() const {
+	return width;
+}
+
+int TextureArray::getHeight() const {
+	return height;
+}
+
+bool TextureArray::isFull() const {
+	return size >= capacity;
+}
+
+// helper
+bool TextureArray::check() {
+	return textureID == 0;
+}
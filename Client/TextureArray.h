@@ -0,0 +1,38 @@
+#pragma once
+#include <GL/glew.h>
+#include <vector>
+
+#define TEXTURE_ARRAY_LAYERS 32
+
+// GL_TEXTURE_2D_ARRAY of same sized images, every image is one layer
+class TextureArray
+{
+private:
+	GLuint textureID;
+	int width;
+	int height;
+	int capacity;
+	int size;
+	bool mipmapped;
+public:
+	// constructors
+	TextureArray();
+
+	// init
+	void init(int width, int height, int capacity = TEXTURE_ARRAY_LAYERS);
+
+	// add
+	int addLayer(const std::vector<unsigned char>& pixels);
+
+	// mipmaps
+	void generateMipmaps();
+
+	// getters
+	GLuint getTextureID() const;
+	int getWidth() const;
+	int getHeight() const;
+	bool isFull() const;
+private:
+	// helper
+	bool check();
+};
@@ -1,7 +1,16 @@
 #include "TextureCache.h"
 #include "ImageLoader.h"
+#include "Counters.h"
+#include "AllocationTracker.h"
 
-GLTexture TextureCache::getTexture(std::string texturePath) {
+static Counter loadedTextures("Textures loaded");
+
+TextureCache::TextureCache() : textureMap(), textureArrays(), arraysChanged(false) {
+
+}
+
+GLTexture TextureCache::getTexture(std::string texturePath, TextureUsage usage) {
+    MEMORY_SCOPE(MemoryTag::TEXTURES);
     // std::map<std::string, GLTexture>::iterator <==> auto
     // lookup for texture and see if it's in the map
     auto mapIterator =  textureMap.find(texturePath);
@@ -9,17 +18,74 @@ GLTexture TextureCache::getTexture(std::string texturePath) {
     // check if it isn't in the map
     if (mapIterator == textureMap.end()) {
         // load the texture
-        GLTexture texture = ImageLoader::loadTexture(texturePath);
+        std::vector<unsigned char> pixels;
+        int width;
+        int height;
+
+        ImageLoader::loadPixels(texturePath, pixels, width, height);
+
+        GLTexture texture = {};
+        texture.width = width;
+        texture.height = height;
+
+        // instanced rectangles sample only the texture array, the 2D texture would never be read
+        if (usage == TextureUsage::ALL) {
+            texture = ImageLoader::createTexture(pixels, width, height);
+        }
+
+        // the same image is also placed in a texture array, instanced sprites are batched by it
+        addToTextureArray(texture, pixels);
 
         // create new pair for the map
         //std::pair<std::string, GLTexture> pair(texturePath, texture);
 
         // insert new texture into the map, shortcut
         textureMap.insert(std::make_pair(texturePath, texture));
+        loadedTextures.add();
         return texture;
     }
 
+    // texture loaded for instancing only is asked for by a 2D user, its 2D texture is created now
+    if (usage == TextureUsage::ALL && mapIterator->second.ID == 0) {
+        std::vector<unsigned char> pixels;
+        int width;
+        int height;
+
+        ImageLoader::loadPixels(texturePath, pixels, width, height);
+        GLTexture texture = ImageLoader::createTexture(pixels, width, height);
+        mapIterator->second.ID = texture.ID;
+    }
+
     // first - key
     // second - value
     return mapIterator->second;
 }
+
+void TextureCache::finalize() {
+    if (!arraysChanged) {
+        return;
+    }
+
+    for (auto& group : textureArrays) {
+        for (TextureArray& textureArray : group.second) {
+            textureArray.generateMipmaps();
+        }
+    }
+
+    arraysChanged = false;
+}
+
+void TextureCache::addToTextureArray(GLTexture& texture, const std::vector<unsigned char>& pixels) {
+    std::vector<TextureArray>& arrays = textureArrays[std::make_pair(texture.width, texture.height)];
+
+    // a new array is started when the last one runs out of layers
+    if (arrays.empty() || arrays.back().isFull()) {
+        arrays.emplace_back();
+        arrays.back().init(texture.width, texture.height);
+    }
+
+    TextureArray& textureArray = arrays.back();
+    texture.layer = textureArray.addLayer(pixels);
+    texture.arrayID = textureArray.getTextureID();
+    arraysChanged = true;
+}
@@ -1,13 +1,35 @@
 #pragma once
 #include <map>
 #include <string>
+#include <vector>
 #include "GLTexture.h"
+#include "TextureArray.h"
+
+// INSTANCED textures are only drawn as instanced rectangles, they get a texture array layer but no 2D texture
+enum class TextureUsage {
+	ALL,
+	INSTANCED
+};
+
 class TextureCache
 {
 private:
 	std::map<std::string, GLTexture> textureMap;
 
+	// texture arrays grouped by size of their layers
+	std::map<std::pair<int, int>, std::vector<TextureArray>> textureArrays;
+
+	// layers were added since mipmaps of the arrays were generated
+	bool arraysChanged;
+
 public:
-	GLTexture getTexture(std::string texturePath);
-};
+	TextureCache();
+
+	GLTexture getTexture(std::string texturePath, TextureUsage usage = TextureUsage::ALL);
+
+	// generates mipmaps of arrays which got new layers, called by the owner of the textures once they are loaded
+	void finalize();
 
+private:
+	void addToTextureArray(GLTexture& texture, const std::vector<unsigned char>& pixels);
+};
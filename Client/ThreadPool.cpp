@@ -0,0 +1,130 @@
+#include "ThreadPool.h"
+#include "Profiler.h"
+
+std::vector<std::thread> ThreadPool::workers;
+std::mutex ThreadPool::mutex;
+std::mutex ThreadPool::runMutex;
+std::condition_variable ThreadPool::workCondition;
+std::condition_variable ThreadPool::doneCondition;
+
+const std::function<void(int)>* ThreadPool::task = nullptr;
+std::atomic<int> ThreadPool::nextTask(0);
+std::atomic<int> ThreadPool::finishedTasks(0);
+int ThreadPool::taskNumber = 0;
+int ThreadPool::activeWorkers = 0;
+int ThreadPool::generation = 0;
+bool ThreadPool::initialized = false;
+bool ThreadPool::running = false;
+
+// init / shutdown
+void ThreadPool::init(int threadNumber) {
+	if (initialized) {
+		return;
+	}
+
+	// calling thread also executes tasks, so one core is left for it
+	if (threadNumber <= 0) {
+		threadNumber = (int)std::thread::hardware_concurrency() - 1;
+	}
+
+	initialized = true;
+	running = true;
+
+	for (int i = 0; i < threadNumber; i++) {
+		workers.emplace_back(&ThreadPool::work);
+	}
+}
+
+void ThreadPool::shutdown() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		running = false;
+	}
+	workCondition.notify_all();
+
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+
+	workers.clear();
+	initialized = false;
+}
+
+// run
+void ThreadPool::run(int taskNumber, const std::function<void(int)>& task) {
+	// pool holds one batch of tasks, a second caller waits until the first batch is done
+	std::lock_guard<std::mutex> runLock(runMutex);
+
+	if (!initialized) {
+		init();
+	}
+
+	// nothing to share, tasks are executed in place
+	if (taskNumber <= 1 || workers.empty()) {
+		for (int i = 0; i < taskNumber; i++) {
+			task(i);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		ThreadPool::task = &task;
+		ThreadPool::taskNumber = taskNumber;
+		nextTask = 0;
+		finishedTasks = 0;
+		generation++;
+	}
+	workCondition.notify_all();
+
+	executeTasks(task, taskNumber);
+
+	// workers still hold the task until they leave executeTasks
+	std::unique_lock<std::mutex> lock(mutex);
+	doneCondition.wait(lock, [taskNumber]() { return finishedTasks == taskNumber && activeWorkers == 0; });
+	ThreadPool::task = nullptr;
+}
+
+// getters
+int ThreadPool::getThreadNumber() {
+	return (int)workers.size() + 1;
+}
+
+// helper
+void ThreadPool::work() {
+	int seenGeneration = 0;
+	Profiler::setThreadName("Worker");
+
+	while (true) {
+		std::unique_lock<std::mutex> lock(mutex);
+		workCondition.wait(lock, [&seenGeneration]() { return !running || (task != nullptr && generation != seenGeneration); });
+
+		if (!running) {
+			return;
+		}
+
+		seenGeneration = generation;
+		const std::function<void(int)>& currentTask = *task;
+		int currentTaskNumber = taskNumber;
+		activeWorkers++;
+		lock.unlock();
+
+		executeTasks(currentTask, currentTaskNumber);
+
+		lock.lock();
+		activeWorkers--;
+		lock.unlock();
+		doneCondition.notify_one();
+	}
+}
+
+void ThreadPool::executeTasks(const std::function<void(int)>& task, int taskNumber) {
+	int index = nextTask++;
+
+	while (index < taskNumber) {
+		PROFILE_ZONE("ThreadPool::task");
+		task(index);
+		finishedTasks++;
+		index = nextTask++;
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads shared by the engine. run() hands out task indices to the
+// workers and the calling thread, and returns when every task is done.
+// run() may be called from any thread, calls are serialized, so one batch of tasks runs at a time.
+// Tasks must not call run() themselves.
+class ThreadPool
+{
+private:
+	static std::vector<std::thread> workers;
+	static std::mutex mutex;
+	static std::mutex runMutex;
+	static std::condition_variable workCondition;
+	static std::condition_variable doneCondition;
+
+	static const std::function<void(int)>* task;
+	static std::atomic<int> nextTask;
+	static std::atomic<int> finishedTasks;
+	static int taskNumber;
+	static int activeWorkers;
+	static int generation;
+	static bool initialized;
+	static bool running;
+public:
+	// init / shutdown
+	static void init(int threadNumber = 0);
+	static void shutdown();
+
+	// run
+	static void run(int taskNumber, const std::function<void(int)>& task);
+
+	// getters
+	static int getThreadNumber();
+private:
+	// helper
+	static void work();
+	static void executeTasks(const std::function<void(int)>& task, int taskNumber);
+};
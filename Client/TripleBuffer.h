@@ -0,0 +1,65 @@
+#pragma once
+#include <atomic>
+
+// shared index carries this bit while it holds a slot the reader has not taken yet
+#define TRIPLE_BUFFER_FRESH 4
+#define TRIPLE_BUFFER_INDEX 3
+
+// Lock free handoff of the newest value from one writer thread to one reader thread. Writer
+// and reader own one slot each, the third one is swapped between them, so neither of them
+// ever waits. Values the reader did not take in time are overwritten by newer ones.
+template <class T>
+class TripleBuffer
+{
+private:
+	T slots[3];
+	std::atomic<int> shared;
+	int back;
+	int front;
+public:
+	// constructors
+	TripleBuffer();
+
+	// writer
+	T& getBack();
+	void publish();
+
+	// reader
+	bool update();
+	T& getFront();
+};
+
+// constructors
+template<class T>
+inline TripleBuffer<T>::TripleBuffer() : slots(), shared(1), back(2), front(0) {
+
+}
+
+// writer
+template<class T>
+inline T& TripleBuffer<T>::getBack() {
+	return slots[back];
+}
+
+template<class T>
+inline void TripleBuffer<T>::publish() {
+	// release makes the written slot visible to the reader which takes it with acquire
+	back = shared.exchange(back | TRIPLE_BUFFER_FRESH, std::memory_order_acq_rel) & TRIPLE_BUFFER_INDEX;
+}
+
+// reader
+template<class T>
+inline bool TripleBuffer<T>::update() {
+	if ((shared.load(std::memory_order_acquire) & TRIPLE_BUFFER_FRESH) == 0) {
+		return false;
+	}
+
+	// only the writer sets the bit, so the shared slot is still fresh when it is exchanged
+	front = shared.exchange(front, std::memory_order_acq_rel) & TRIPLE_BUFFER_INDEX;
+	return true;
+}
+
+template<class T>
+inline T& TripleBuffer<T>::getFront() {
+	return slots[front];
+}
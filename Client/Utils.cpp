@@ -1,9 +1,15 @@
 #define _USE_MATH_DEFINES
 #include "Utils.h"
 #include "ImageLoader.h"
+#include "Profiler.h"
+#include "Counters.h"
+#include "AllocationTracker.h"
 #include <iostream>
 #include <cmath>
 
+static Counter raysTested("Rays tested");
+static Counter edgesTested("Ray edge tests");
+
 void Utils::loadMap(std::string filePath, std::vector<Square>& blocks, float unitWidth, float unitHeight) {
 	Image image = ImageLoader::loadImage(filePath);
 
@@ -127,6 +133,8 @@ std::vector<Point>& Utils::convertToPlayerPath(std::vector<Point>& points, float
 }
 
 void Utils::createEdges(SearchSpace& searchSpace, std::vector<Block>& visibleBlockEdges, std::vector<Edge*>& edges, float mapHeight, float unitWidth, float unitHeight) {
+	PROFILE_FUNCTION();
+	MEMORY_SCOPE(MemoryTag::EDGES);
 	// if default mode is being used for edge generation
 	for (size_t i = 0; i < visibleBlockEdges.size(); i++) {
 		Block block = visibleBlockEdges[i];
@@ -235,6 +243,7 @@ void Utils::createEdges(SearchSpace& searchSpace, std::vector<Block>& visibleBlo
 }
 
 void Utils::createLightEdges(Light* light, std::vector<Edge*>& edges) {
+	MEMORY_SCOPE(MemoryTag::EDGES);
 	Square lightBounds = light->getBounds();
 
 	float x = lightBounds.getX();
@@ -280,6 +289,9 @@ void Utils::createEdgePoints(Light* light, std::vector<Edge*>& edges, std::vecto
 }
 
 void Utils::rayTracing(std::vector<Edge*>& edges, std::vector<glm::vec2>& edgePoints, std::vector<LightPoint>& intersectionPoints, glm::vec2 p) {
+	PROFILE_FUNCTION();
+	size_t firstPoint = intersectionPoints.size();
+
 	for (size_t i = 0; i < edgePoints.size(); i++) {
 		glm::vec2 point = edgePoints[i];
 
@@ -321,8 +333,13 @@ void Utils::rayTracing(std::vector<Edge*>& edges, std::vector<glm::vec2>& edgePo
 	}
 
 	std::sort(intersectionPoints.begin(), intersectionPoints.end(), sortCriteria);
+
+	// every ray is tested against every edge, so both are counted once per call
+	raysTested.add((long long)(intersectionPoints.size() - firstPoint));
+	edgesTested.add((long long)(intersectionPoints.size() - firstPoint) * edges.size());
 }
 Light* Utils::lightGenerator(float x, float y, float unitWidth, float unitHeight) {
+	MEMORY_SCOPE(MemoryTag::LIGHTS);
 	Light* light = nullptr;
 
 	int r = rand() % 255 + 1; // from 1 to 255
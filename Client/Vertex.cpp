@@ -40,3 +40,18 @@ void Vertex::setPosition(Position position) {
 	this->position = position;
 }
 
+ColorVertex::ColorVertex() : position(), color() {
+
+}
+
+ColorVertex::ColorVertex(float x, float y, Color color) : position(x, y), color(color) {
+
+}
+
+StaticVertex::StaticVertex() : position(), color() {
+
+}
+
+StaticVertex::StaticVertex(GLushort x, GLushort y, Color color) : position{ x, y }, color(color) {
+
+}
\ No newline at end of file
@@ -20,4 +20,24 @@ public:
 	void setUV(UV uv);
 	void setPosition(float x, float y);
 	void setPosition(Position position);
+};
+
+// untextured vertex (12 bytes), used by geometry and light masks
+class ColorVertex {
+public:
+	Position position;
+	Color color;
+public:
+	ColorVertex();
+	ColorVertex(float x, float y, Color color);
+};
+
+// static geometry vertex (8 bytes), position is normalized to the bounds of the whole static buffer
+class StaticVertex {
+public:
+	GLushort position[2];
+	Color color;
+public:
+	StaticVertex();
+	StaticVertex(GLushort x, GLushort y, Color color);
 };
\ No newline at end of file
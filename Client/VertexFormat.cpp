@@ -0,0 +1,83 @@
+#include "VertexFormat.h"
+#include "Vertex.h"
+#include "RectInstance.h"
+#include "GraphicsBackend.h"
+
+VertexFormat::VertexFormat() : attributes(), stride(0), divisor(0) {
+
+}
+
+VertexFormat::VertexFormat(GLsizei stride, GLuint divisor) : attributes(), stride(stride), divisor(divisor) {
+
+}
+
+// add
+VertexFormat& VertexFormat::add(GLint size, GLenum type, GLboolean normalized, size_t offset) {
+	attributes.push_back(VertexAttribute{ size, type, normalized, offset });
+	return *this;
+}
+
+// bind
+void VertexFormat::enableAttributes() const {
+	// must be called with the vertex array bound
+	for (size_t i = 0; i < attributes.size(); i++) {
+		GraphicsBackend::get().enableVertexAttribArray((GLuint)i);
+		if (divisor != 0) {
+			GraphicsBackend::get().vertexAttribDivisor((GLuint)i, divisor);
+		}
+	}
+}
+
+void VertexFormat::bindAttributes(size_t baseOffset) const {
+	// must be called with the vertex array and its buffer bound
+	for (size_t i = 0; i < attributes.size(); i++) {
+		const VertexAttribute& attribute = attributes[i];
+		GraphicsBackend::get().vertexAttribPointer((GLuint)i, attribute.size, attribute.type, attribute.normalized, stride, (void*)(baseOffset + attribute.offset));
+	}
+}
+
+// getters
+GLsizei VertexFormat::getStride() const {
+	return stride;
+}
+
+GLuint VertexFormat::getDivisor() const {
+	return divisor;
+}
+
+int VertexFormat::getAttributeNumber() const {
+	return (int)attributes.size();
+}
+
+// formats
+VertexFormat VertexFormat::createColorVertex() {
+	// position, color
+	return VertexFormat(sizeof(ColorVertex))
+		.add(2, GL_FLOAT, GL_FALSE, offsetof(ColorVertex, position))
+		.add(4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(ColorVertex, color));
+}
+
+VertexFormat VertexFormat::createVertex() {
+	// position, color, uv
+	return VertexFormat(sizeof(Vertex))
+		.add(2, GL_FLOAT, GL_FALSE, offsetof(Vertex, position))
+		.add(4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(Vertex, color))
+		.add(2, GL_FLOAT, GL_FALSE, offsetof(Vertex, uv));
+}
+
+VertexFormat VertexFormat::createStaticVertex() {
+	// normalized position, color
+	return VertexFormat(sizeof(StaticVertex))
+		.add(2, GL_UNSIGNED_SHORT, GL_TRUE, offsetof(StaticVertex, position))
+		.add(4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(StaticVertex, color));
+}
+
+VertexFormat VertexFormat::createRectInstance() {
+	// position, size, color, uv, layer, every attribute advances once per instance
+	return VertexFormat(sizeof(RectInstance), 1)
+		.add(2, GL_FLOAT, GL_FALSE, offsetof(RectInstance, position))
+		.add(2, GL_HALF_FLOAT, GL_FALSE, offsetof(RectInstance, size))
+		.add(4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(RectInstance, color))
+		.add(4, GL_UNSIGNED_SHORT, GL_TRUE, offsetof(RectInstance, uv))
+		.add(1, GL_UNSIGNED_SHORT, GL_FALSE, offsetof(RectInstance, layer));
+}
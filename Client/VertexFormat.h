@@ -0,0 +1,43 @@
+#pragma once
+#include <GL/glew.h>
+#include <vector>
+
+// one attribute of a vertex, locations follow the order attributes were added in
+struct VertexAttribute {
+	GLint size;
+	GLenum type;
+	GLboolean normalized;
+	size_t offset;
+};
+
+// Layout of one vertex buffer. Vertex arrays are set up from it instead of repeating
+// attribute pointers, so every buffer can use the smallest layout its programs need.
+class VertexFormat
+{
+private:
+	std::vector<VertexAttribute> attributes;
+	GLsizei stride;
+	GLuint divisor;
+public:
+	// constructors
+	VertexFormat();
+	VertexFormat(GLsizei stride, GLuint divisor = 0);
+
+	// add
+	VertexFormat& add(GLint size, GLenum type, GLboolean normalized, size_t offset);
+
+	// bind
+	void enableAttributes() const;
+	void bindAttributes(size_t baseOffset = 0) const;
+
+	// getters
+	GLsizei getStride() const;
+	GLuint getDivisor() const;
+	int getAttributeNumber() const;
+
+	// formats
+	static VertexFormat createColorVertex();
+	static VertexFormat createVertex();
+	static VertexFormat createStaticVertex();
+	static VertexFormat createRectInstance();
+};
@@ -0,0 +1,45 @@
+#include "VertexStaging.h"
+#include "AllocationTracker.h"
+
+VertexStaging::VertexStaging() : data(), stride(0), size(0) {
+
+}
+
+// init
+void VertexStaging::init(GLsizei stride) {
+	this->stride = stride;
+	clear();
+}
+
+// allocate / clear
+void* VertexStaging::allocate(int count) {
+	size_t end = (size_t)(size + count) * stride;
+
+	// capacity is doubled, so vertices are not copied on every allocation
+	if (end > data.size()) {
+		MEMORY_SCOPE(MemoryTag::RENDERER);
+		data.resize(end > data.size() * 2 ? end : data.size() * 2);
+	}
+
+	void* vertices = &data[(size_t)size * stride];
+	size = size + count;
+
+	return vertices;
+}
+
+void VertexStaging::clear() {
+	size = 0;
+}
+
+// getters
+const GLubyte* VertexStaging::getData() const {
+	return data.data();
+}
+
+GLsizei VertexStaging::getStride() const {
+	return stride;
+}
+
+int VertexStaging::getSize() const {
+	return size;
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include "VertexStream.h"
+#include <GL/glew.h>
+#include <vector>
+
+// Vertices kept in system memory, used by recording contexts which can't write to mapped
+// buffers from their threads. Memory is kept from frame to frame.
+class VertexStaging : public VertexStream
+{
+private:
+	std::vector<GLubyte> data;
+	GLsizei stride;
+	int size;
+public:
+	// constructors
+	VertexStaging();
+
+	// init
+	void init(GLsizei stride);
+
+	// allocate / clear
+	void* allocate(int count) override;
+	void clear();
+
+	// getters
+	const GLubyte* getData() const;
+	GLsizei getStride() const;
+	int getSize() const override;
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+// Anything GLSL objects can write their vertices to. Offsets of objects are the size
+// of the stream before their vertices were allocated.
+class VertexStream
+{
+public:
+	virtual ~VertexStream() {}
+
+	// allocate
+	virtual void* allocate(int count) = 0;
+
+	// getters
+	virtual int getSize() const = 0;
+};
@@ -45,4 +45,20 @@ static const std::string LIGHT_VERTEX_PATH = "Shaders/lightShader.vert";
 static const std::string LIGHT_FRAGMENT_PATH = "Shaders/lightShader.frag";
 
 // levels
-static const std::string MAP_PATH = "Maps/Level1.png";
\ No newline at end of file
+static const std::string MAP_PATH = "Maps/Level1.png";
+
+// simulation config
+// simulation of the next frame runs on its own thread while the last one is drawn, false runs them in sequence
+static const bool PIPELINED_SIMULATION = true;
+
+// profiler and counters output, written when the game exits
+static const std::string PROFILE_PATH = "profile.json";
+static const std::string COUNTERS_PATH = "counters.csv";
+
+// command line argument which runs the headless renderer benchmark instead of the game
+static const std::string BENCHMARK_ARGUMENT = "--benchmark";
+
+// memory budgets in bytes, a warning is logged when live memory of the subsystem goes above it
+static const long long EDGES_BUDGET = 1024 * 1024;
+static const long long LIGHTS_BUDGET = 64 * 1024;
+static const long long PATHFINDING_BUDGET = 4 * 1024 * 1024;
\ No newline at end of file
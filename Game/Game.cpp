@@ -2,9 +2,15 @@
 #include "Config.h"
 #include <LightPoint.h>
 #include <Utils.h>
+#include <GraphicsBackend.h>
 #include <Light.h>
 #include <ResourceManager.h>
 #include <Collision.h>
+#include <ThreadPool.h>
+#include <Profiler.h>
+#include <Counters.h>
+#include <AllocationTracker.h>
+#include <NetworkCounters.h>
 #include <GL/glew.h>
 #include <iostream>
 #include <thread>
@@ -22,6 +28,9 @@ void Game::init(std::string title, int screenWidth, int screenHeight) {
 	initBackgroundProps(CLEAR_R, CLEAR_G, CLEAR_B, CLEAR_A);
 	initComponents();
 	initLevel(MAP_PATH);
+
+	// every texture is loaded, texture arrays build their mipmaps once
+	ResourceManager::finalizeTextures();
 	run();
 }
 
@@ -30,8 +39,8 @@ void Game::initWindow(std::string title, int screenWidth, int screenHeight) {
 }
 
 void Game::initBackgroundProps(float r, float g, float b, float a) {
-	glClearColor(r, g, b, a);
-	glEnable(GL_BLEND);
+	GraphicsBackend::get().clearColor(r, g, b, a);
+	GraphicsBackend::get().enable(GL_BLEND);
 }
 
 void Game::initComponents() {
@@ -44,7 +53,7 @@ void Game::initComponents() {
 	tileSheet.init(bubbleTexture, glm::ivec2(15, 10));
 
 	renderer.init(camera);
-	renderer.setMode(RenderMode::SHADOWS);
+	renderer.setMode(RenderMode::MULTI_SHADOWS);
 
 	mouseLight.init(10 * UNIT_WIDTH, 1.0f, glm::vec2(160, 160), RED);
 	playerLight.init(20 * UNIT_WIDTH, 1.0f, glm::vec2(START_PLAYER_X, START_PLAYER_Y), BLUE);
@@ -53,27 +62,135 @@ void Game::initComponents() {
 
 	lights.emplace_back(&playerLight);
 	lights.emplace_back(&mouseLight);
+
+	AllocationTracker::setBudget(MemoryTag::EDGES, EDGES_BUDGET);
+	AllocationTracker::setBudget(MemoryTag::LIGHTS, LIGHTS_BUDGET);
+	AllocationTracker::setBudget(MemoryTag::PATHFINDING, PATHFINDING_BUDGET);
 }
 
 void Game::initLevel(std::string filePath) {
 	Utils::loadMSPL(filePath, lights, blocks, edgeBlocks, searchSpace, UNIT_WIDTH, UNIT_HEIGHT);
 	algorithm.setSearchSpace(&searchSpace);
 	renderer.setLights(lights);
+	initStaticGeometry();
+	initLightmaps();
+}
+
+void Game::initStaticGeometry() {
+	// blocks never move, so they are uploaded once instead of being drawn every frame
+	renderer.clearStaticGeometry();
+
+	for (size_t i = 0; i < blocks.size(); i++) {
+		renderer.addStaticSquare(blocks[i].getBounds(), GREEN);
+	}
+
+	renderer.buildStaticGeometry();
+}
+
+void Game::initLightmaps() {
+	// lights from the level never move and their occluders never change, so they are baked once
+	std::vector<Light*> staticLights;
+	std::vector<Square> occluders;
+
+	for (size_t i = 0; i < lights.size(); i++) {
+		if (lights[i] != &playerLight && lights[i] != &mouseLight) {
+			staticLights.push_back(lights[i]);
+		}
+	}
+
+	for (size_t i = 0; i < edgeBlocks.size(); i++) {
+		occluders.push_back(edgeBlocks[i].getBounds());
+	}
+
+	renderer.clearLightmaps();
+	renderer.bakeLights(staticLights, occluders);
 }
 
 void Game::run() {
+	Profiler::setThreadName("Main");
+
+	// first frame is drawn from the initial state
+	publishFrameState();
+
+	if (PIPELINED_SIMULATION) {
+		simulation = std::thread(&Game::simulate, this);
+	}
+
 	while (gameState == GameState::PLAY) {
+		PROFILE_ZONE("Game::frame");
 		calculateFPS();
 		printFPS();
 		receiveInput();
 		processInput();
-		update(time.getDeltaTime());
+
+		if (!PIPELINED_SIMULATION) {
+			update(time);
+			publishFrameState();
+		}
+
+		// camera belongs to the drawing thread, it follows input at the full frame rate
+		frames.update();
+		updateView(time.getDeltaTime());
 		draw();
 		//reset();
+		Profiler::endFrame();
+		AllocationTracker::endFrame();
+		NetworkCounters::update();
+		Counters::snapshot();
+
+		// frame time is measured after zones of the frame were collected, hitches report them
+		frameStats.update();
+	}
+
+	if (simulation.joinable()) {
+		simulation.join();
+	}
+
+	// workers were started by the lightmap bake
+	ThreadPool::shutdown();
+
+	// zones of the last frames, open with chrome://tracing
+	Profiler::exportChromeTrace(PROFILE_PATH);
+	Counters::exportCSV(COUNTERS_PATH);
+}
+
+void Game::simulate() {
+	Profiler::setThreadName("Simulation");
+
+	// simulation of the next frame overlaps drawing of the last published one
+	while (gameState == GameState::PLAY) {
+		Uint32 startTime = SDL_GetTicks();
+
+		simulationTime.calculateFPS();
+		update(simulationTime);
+		publishFrameState();
+
+		// drawing takes the newest state, so simulating faster than the desired rate only wastes a core
+		Uint32 elapsedTime = SDL_GetTicks() - startTime;
+		if (elapsedTime < DESIRED_FRAMETIME) {
+			SDL_Delay((Uint32)(DESIRED_FRAMETIME - elapsedTime));
+		}
 	}
 }
 
+void Game::publishFrameState() {
+	PROFILE_FUNCTION();
+	FrameState& state = frames.getBack();
+
+	state.playerBounds = player->getBounds();
+	state.playerTexture = player->getTexture();
+
+	// vectors keep their memory, slots are reused every third frame
+	state.lights.clear();
+	for (size_t i = 0; i < lights.size(); i++) {
+		state.lights.push_back(*lights[i]);
+	}
+
+	frames.publish();
+}
+
 void Game::receiveInput() {
+	PROFILE_FUNCTION();
 	SDL_Event event;
 
 	while (SDL_PollEvent(&event)) {
@@ -120,6 +237,7 @@ void Game::receiveInput() {
 }
 
 void Game::processInput() {
+	PROFILE_FUNCTION();
 	if (inputManager.isKeyPressed(SDLK_ESCAPE)) {
 		gameState = GameState::EXIT;
 	}
@@ -138,6 +256,9 @@ void Game::processInput() {
 }
 
 void Game::search() {
+	Profiler::setThreadName("Search");
+	PROFILE_FUNCTION();
+
 	std::cout << std::endl;
 
 	glm::vec2 mouseCoords = camera.convertScreenToWorld(inputManager.getMouseCoords());
@@ -193,6 +314,10 @@ void Game::calculateFPS() {
 
 void Game::printFPS() {
 	time.printFPS();
+	Profiler::printSummary();
+	Counters::printSnapshot();
+	AllocationTracker::printSummary();
+	frameStats.printSummary();
 }
 
 void Game::updateCameraPosition(int xrel, int yrel) {
@@ -202,14 +327,16 @@ void Game::updateCameraPosition(int xrel, int yrel) {
 	}
 }
 
-void Game::updatePlayer(float deltaTime) {
-	player->update(deltaTime, time.getTime());
+void Game::updatePlayer(float deltaTime, Timer& timer) {
+	// animation follows the clock of the thread which simulates, not the drawing one
+	player->update(deltaTime, timer.getTime());
 	
 }
 
 void Game::updateCamera(float deltaTime) {
 	if (inputManager.isKeyPressed(SDLK_SPACE)) {
-		camera.reset(getCameraPosition(glm::vec2(player->getX(), player->getY())));
+		Square playerBounds = frames.getFront().playerBounds;
+		camera.reset(getCameraPosition(glm::vec2(playerBounds.getX(), playerBounds.getY())));
 		camera.update();
 		return;
 	}
@@ -236,7 +363,7 @@ void Game::updateCamera(float deltaTime) {
 }
 
 void Game::updateLight(Uint32 frameTime) {
-	mouseLight.setSource(camera.convertScreenToWorld(inputManager.getMouseCoords()));
+	// mouse light follows the camera, it is moved by the drawing thread in prepareFrameLights
 	playerLight.setSource(player->getCenter());
 
 	for (size_t i = 0; i < lights.size(); i++) {
@@ -273,25 +400,65 @@ void Game::zoom(int zoomY) {
 	}
 }
 
-void Game::update(float deltaTime) {
+void Game::update(Timer& timer) {
+	PROFILE_FUNCTION();
+	float deltaTime = timer.getDeltaTime();
+	int i = 0;
+	while (deltaTime > 0.0f && i < MAX_STEPS) {
+		float time = glm::min(deltaTime, 1.0f);
+		updatePlayer(time, timer);
+		deltaTime -= time;
+		i++;
+	}
+	updateLight((Uint32)timer.getFrameTime());
+}
+
+void Game::updateView(float deltaTime) {
 	int i = 0;
 	while (deltaTime > 0.0f && i < MAX_STEPS) {
 		float time = glm::min(deltaTime, 1.0f);
-		updatePlayer(time);
 		updateCamera(time);
 		deltaTime -= time;
 		i++;
 	}
-	updateLight(time.getFrameTime());
+}
+
+void Game::prepareFrameLights() {
+	FrameState& state = frames.getFront();
+
+	// renderer reads lights of the drawn state, simulation keeps updating its own
+	frameLights.clear();
+	for (size_t i = 0; i < state.lights.size(); i++) {
+		Light* light = &state.lights[i];
+		if (light->getID() == mouseLight.getID()) {
+			light->setSource(camera.convertScreenToWorld(inputManager.getMouseCoords()));
+		}
+		frameLights.push_back(light);
+	}
+
+	renderer.setLights(frameLights);
+}
+
+Light* Game::getFrameLight(const Light& light) {
+	for (size_t i = 0; i < frameLights.size(); i++) {
+		if (frameLights[i]->getID() == light.getID()) {
+			return frameLights[i];
+		}
+	}
+	return nullptr;
 }
 
 void Game::draw() {
-	glClearDepth(1.0f);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	PROFILE_FUNCTION();
+	prepareFrameLights();
+
+	GraphicsBackend::get().clearDepth(1.0f);
+	GraphicsBackend::get().clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+	// lights are accumulated at lower resolution when frames take too long
+	renderer.setFrameTime(time.getFrameTime());
 	renderer.begin();
 
-	drawBlocks();
 	drawPlayer();
 	drawLights();
 	//drawGrid();
@@ -301,12 +468,14 @@ void Game::draw() {
 
 	renderer.end();
 
+	PROFILE_ZONE("SDL_GL_SwapWindow");
 	SDL_GL_SwapWindow(window);
 }
 
 void Game::drawLights() {
-	for (size_t i = 0; i < lights.size(); i++) {
-		Light* light = lights[i];
+	PROFILE_FUNCTION();
+	for (size_t i = 0; i < frameLights.size(); i++) {
+		Light* light = frameLights[i];
 
 		if (!cameraCulling(light->getBounds())) {
 			continue;
@@ -314,6 +483,11 @@ void Game::drawLights() {
 
 		renderer.drawLight(light);
 
+		// baked lights already have their shadows in the lightmap
+		if (renderer.isLightBaked(light)) {
+			continue;
+		}
+
 		for (size_t i = 0; i < edgeBlocks.size(); i++) {
 			Block edgeBlock = edgeBlocks[i];
 			if (Collision::squareCollision(light->getBounds(), edgeBlock.getBounds())) {
@@ -385,45 +559,27 @@ void Game::drawEdges(std::vector<Edge*> edges) {
 	}
 }
 
-void Game::drawBlocks() {
-	for (size_t i = 0; i < lights.size(); i++) {
-		Light* light = lights[i];
-		if (!cameraCulling(light->getBounds())) {
-			continue;
-		}
-		for (size_t j = 0; j < blocks.size(); j++) {
-			Block block = blocks[j];
+void Game::drawPlayer() {
+	FrameState& state = frames.getFront();
+	Light* frameMouseLight = getFrameLight(mouseLight);
+	Light* framePlayerLight = getFrameLight(playerLight);
 
-			if (Collision::squareCollision(light->getBounds(), block.getBounds())) {
-				renderer.drawSquare(light, block.getBounds(), GREEN);
-			}
-		}
+	if (frameMouseLight == nullptr || framePlayerLight == nullptr) {
+		return;
 	}
 
-	/*for (size_t i = 0; i < blocks.size(); i++) {
-		if (cameraCulling(blocks[i].getBounds())) {
-			renderer.drawSquare(blocks[i].getBounds(), GREEN);
-		}
-	}*/
-
-	/*if (squarePathID != -1) {
-		for (size_t i = squarePathID; i < squarePath.size(); i++) {
-			if (i == squarePath.size() - 1) {
-				renderer.drawSquare(squarePath[squarePath.size() - 1], RED);
-			}
-			else {
-				renderer.drawSquare(squarePath[i]);
-			}
-		}
-	}*/
-}
+	// multi light mode has no per light lists, player is drawn once and shaded by every light
+	if (renderer.getMode() == RenderMode::MULTI_SHADOWS) {
+		renderer.drawVisibleSquare(state.playerBounds, BLUE);
+		renderer.drawVisibleTexture(state.playerBounds, state.playerTexture);
+		return;
+	}
 
-void Game::drawPlayer() {
-	if (Collision::squareCollision(mouseLight.getBounds(), player->getBounds())) {
-		renderer.drawSquare(&mouseLight, player->getBounds(), BLUE);
+	if (Collision::squareCollision(frameMouseLight->getBounds(), state.playerBounds)) {
+		renderer.drawSquare(frameMouseLight, state.playerBounds, BLUE);
 	}
-	renderer.drawSquare(&playerLight, player->getBounds(), BLUE);
-	renderer.drawTexture(&playerLight, player->getBounds(), player->getTexture());
+	renderer.drawSquare(framePlayerLight, state.playerBounds, BLUE);
+	renderer.drawTexture(framePlayerLight, state.playerBounds, state.playerTexture);
 }
 
 void Game::updatePlayerPath(std::vector<Point> playerPath) {
@@ -451,6 +607,6 @@ bool Game::checkCollision(float x, float y) {
 }
 
 bool Game::cameraCulling(Square square) {
-	return Collision::squareCollision(camera.getBounds(), square);
+	return camera.isBlockInView(square.getX(), square.getY(), square.getWidth(), square.getHeight());
 }
 
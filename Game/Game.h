@@ -17,8 +17,12 @@
 #include <TextureAtlas.h>
 #include <Block.h>
 #include <Timer.h>
+#include <FrameStats.h>
+#include <TripleBuffer.h>
 #include <string>
 #include <vector>
+#include <thread>
+#include <atomic>
 #include "Player.h"
 
 enum class GameState {
@@ -31,12 +35,21 @@ enum class WindowState {
 	MINIMIZED
 };
 
+// everything drawing reads from simulation, copied once per simulated frame
+struct FrameState {
+	Square playerBounds;
+	GLTexture playerTexture;
+	std::vector<Light> lights;
+
+	FrameState() : playerBounds(), playerTexture(), lights() {}
+};
+
 class Game
 {
 private:
 	SDL_Window* window;
 	Renderer renderer;
-	GameState gameState;
+	std::atomic<GameState> gameState;
 	WindowState windowState;
 	TextureAtlas textureAtlas;
 	GLTexture bubbleTexture;
@@ -45,6 +58,8 @@ private:
 	InputManager inputManager;
 	Player* player;
 	Timer time;
+	Timer simulationTime;
+	FrameStats frameStats;
 	SearchSpace searchSpace;
 	AStarAlgorithm algorithm;
 	TileSheet tileSheet;
@@ -60,6 +75,11 @@ private:
 	Light playerLight;
 
 	int squarePathID;
+
+	// simulation thread publishes, drawing thread takes the newest published state
+	std::thread simulation;
+	TripleBuffer<FrameState> frames;
+	std::vector<Light*> frameLights;
 public:
 	Game(std::string title, int screenWidth, int screenHeight);
 	~Game();
@@ -69,16 +89,23 @@ private:
 	void initBackgroundProps(float r, float g, float b, float a);
 	void initComponents();
 	void initLevel(std::string filePath);
+	void initStaticGeometry();
+	void initLightmaps();
 	void receiveInput();
 	void processInput();
 	void calculateFPS();
 	void updateCameraPosition(int xrel, int yrel);
-	void updatePlayer(float deltaTime);
+	void updatePlayer(float deltaTime, Timer& timer);
 	void updateCamera(float deltaTime);
 	void updateLight(Uint32 frameTime);
 	void updateWindowState(Uint32 flag);
 	void zoom(int zoomY);
-	void update(float deltaTime);
+	void update(Timer& timer);
+	void updateView(float deltaTime);
+	void simulate();
+	void publishFrameState();
+	void prepareFrameLights();
+	Light* getFrameLight(const Light& light);
 	void printFPS();
 	void run();
 	void draw();
@@ -86,7 +113,6 @@ private:
 	void drawLightArea(std::vector<LightPoint>& intersectionPoints, glm::vec2& visionCenter, Color lightColor);
 	void drawGrid();
 	void drawEdges(std::vector<Edge*> edges);
-	void drawBlocks();
 	void drawPlayer();
 	void search();
 	void reset();
@@ -3,6 +3,8 @@
 #include <SDLException.h>
 #include <iostream>
 #include <PriorityQueue.h>
+#include <RendererBenchmark.h>
+#include <string>
 
 //void print(char* array) {
 //	std::cout << array[0];
@@ -35,6 +37,12 @@ void test1() {
 
 int main(int argc, char* argv[]) {
 
+	// renderer is measured headless, no window or GL context is created
+	if (argc > 1 && std::string(argv[1]) == BENCHMARK_ARGUMENT) {
+		RendererBenchmark::run(SCREEN_WIDTH, SCREEN_HEIGHT);
+		return 0;
+	}
+
 	test1();
 
 	/*Game* game = nullptr;
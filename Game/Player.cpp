@@ -8,18 +8,18 @@ Player::Player(float x, float y, float width, float height) : bounds(x, y, width
 }
 
 void Player::init() {
-	GLTexture texture1 = ResourceManager::getTexture("Textures/jimmyJump_pack/PNG/CharacterRight_Standing.png");
-	GLTexture texture2 = ResourceManager::getTexture("Textures/jimmyJump_pack/PNG/CharacterRight_Walk1.png");
-	GLTexture texture3 = ResourceManager::getTexture("Textures/jimmyJump_pack/PNG/CharacterRight_Walk2.png");
+	GLTexture texture1 = ResourceManager::getTexture("Textures/jimmyJump_pack/PNG/CharacterRight_Standing.png", TextureUsage::INSTANCED);
+	GLTexture texture2 = ResourceManager::getTexture("Textures/jimmyJump_pack/PNG/CharacterRight_Walk1.png", TextureUsage::INSTANCED);
+	GLTexture texture3 = ResourceManager::getTexture("Textures/jimmyJump_pack/PNG/CharacterRight_Walk2.png", TextureUsage::INSTANCED);
 
 	animationRight.addTexture(texture1);
 	animationRight.addTexture(texture2);
 	animationRight.addTexture(texture3);
 	animationRight.setFrameTime(200);
 
-	texture1 = ResourceManager::getTexture("Textures/jimmyJump_pack/PNG/CharacterLeft_Standing.png");
-	texture2 = ResourceManager::getTexture("Textures/jimmyJump_pack/PNG/CharacterLeft_Walk1.png");
-	texture3 = ResourceManager::getTexture("Textures/jimmyJump_pack/PNG/CharacterLeft_Walk2.png");
+	texture1 = ResourceManager::getTexture("Textures/jimmyJump_pack/PNG/CharacterLeft_Standing.png", TextureUsage::INSTANCED);
+	texture2 = ResourceManager::getTexture("Textures/jimmyJump_pack/PNG/CharacterLeft_Walk1.png", TextureUsage::INSTANCED);
+	texture3 = ResourceManager::getTexture("Textures/jimmyJump_pack/PNG/CharacterLeft_Walk2.png", TextureUsage::INSTANCED);
 
 	animationLeft.addTexture(texture1);
 	animationLeft.addTexture(texture2);
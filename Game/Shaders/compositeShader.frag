@@ -0,0 +1,18 @@
+#version 330
+
+// input
+in vec2 fragmentUV;
+
+// output
+out vec4 color;
+
+// uniform
+uniform sampler2D lightMap;
+uniform vec2 lightScale;
+uniform vec2 lightLimit;
+
+void main() {
+    // only the scaled part of the texture was rendered, clamp keeps filtering inside of it
+    vec2 uv = min(fragmentUV * lightScale, lightLimit);
+    color = texture(lightMap, uv);
+}
@@ -0,0 +1,13 @@
+#version 330
+
+// output
+out vec2 fragmentUV;
+
+void main() {
+    // one triangle covers the whole screen, corners are generated from vertex id
+    vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+
+    gl_Position = vec4(position * 2.0f - 1.0f, 0.0f, 1.0f);
+
+    fragmentUV = position;
+}
@@ -4,8 +4,10 @@
 in vec2 vertexPosition;
 in vec4 vertexColor;
 
-// uniform
-uniform mat4 cameraMatrix;
+// uniform block, shared by every program
+layout(std140) uniform Camera {
+    mat4 cameraMatrix;
+};
 
 // output
 out vec4 fragmentColor;
@@ -0,0 +1,35 @@
+#version 330
+
+// input
+in vec2 instancePosition;
+in vec2 instanceSize;
+in vec4 instanceColor;
+in vec4 instanceUV;
+in float instanceLayer;
+
+// uniform block, shared by every program
+layout(std140) uniform Camera {
+    mat4 cameraMatrix;
+};
+
+// output
+out vec2 fragmentPosition;
+out vec2 fragmentUV;
+out vec4 fragmentColor;
+flat out float fragmentLayer;
+
+// quad corners drawn as triangle strip: bottom-left, bottom-right, top-left, top-right
+const vec2 corners[4] = vec2[4](vec2(0.0f, 0.0f), vec2(1.0f, 0.0f), vec2(0.0f, 1.0f), vec2(1.0f, 1.0f));
+
+void main() {
+    vec2 corner = corners[gl_VertexID];
+    vec2 position = instancePosition + corner * instanceSize;
+    vec2 uv = instanceUV.xy + corner * instanceUV.zw;
+
+    gl_Position = cameraMatrix * vec4(position, 0.0f, 1.0f);
+
+    fragmentPosition = position;
+    fragmentUV = vec2(uv.x, 1.0f - uv.y);
+    fragmentColor = instanceColor;
+    fragmentLayer = instanceLayer;
+}
\ No newline at end of file
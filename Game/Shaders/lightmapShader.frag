@@ -0,0 +1,19 @@
+#version 330
+
+// input
+in vec2 fragmentUV;
+in vec4 fragmentColor;
+
+// output
+out vec4 color;
+
+// uniform
+uniform sampler2D asset;
+uniform float intensity;
+
+void main() {
+    vec4 lightmap = texture(asset, fragmentUV);
+
+    // lightmap is baked at intensity 1, the LIGHT pass applies intensity to color and alpha
+    color = vec4(lightmap.rgb * intensity * intensity, lightmap.a);
+}
@@ -0,0 +1,41 @@
+#version 330
+
+// must be the same as MAX_LIGHTS in LightBuffer.h
+#define MAX_LIGHTS 32
+
+// input
+in vec4 fragmentColor;
+in vec2 fragmentPosition;
+
+// output
+out vec4 color;
+
+// uniform block, every light is packed as (source.x, source.y, radius, intensity)
+layout(std140) uniform Lights {
+    vec4 lights[MAX_LIGHTS];
+    int lightCount;
+};
+
+// uniform, -1 shades the fragment with every light
+uniform int lightIndex;
+
+float lightFactor(vec4 light) {
+    float dist = length(fragmentPosition - light.xy) / light.z;
+    float factor = pow(0.01f, dist) - 0.01f;
+    return max(factor, 0.0f) * light.w;
+}
+
+void main() {
+    float factor = 0.0f;
+
+    if (lightIndex >= 0) {
+        factor = lightFactor(lights[lightIndex]);
+    }
+    else {
+        for (int i = 0; i < lightCount; i++) {
+            factor = factor + lightFactor(lights[i]);
+        }
+    }
+
+    color = fragmentColor * factor;
+}
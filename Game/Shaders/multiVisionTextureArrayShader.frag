@@ -0,0 +1,18 @@
+#version 330
+
+// input
+in vec2 fragmentPosition;
+in vec2 fragmentUV;
+in vec4 fragmentColor;
+flat in float fragmentLayer;
+
+// output
+out vec4 color;
+
+// texture uniform, every texture of the same size is one layer
+uniform sampler2DArray asset;
+
+void main() {
+    // visible textures are not shaded by lights, same as visionTextureShader
+    color = fragmentColor * texture(asset, vec3(fragmentUV, fragmentLayer));
+}
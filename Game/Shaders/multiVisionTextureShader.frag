@@ -0,0 +1,17 @@
+#version 330
+
+// input
+in vec2 fragmentPosition;
+in vec2 fragmentUV;
+in vec4 fragmentColor;
+
+// output
+out vec4 color;
+
+// texture uniform
+uniform sampler2D asset;
+
+void main() {
+    // visible textures are not shaded by lights, same as visionTextureShader
+    color = fragmentColor * texture(asset, fragmentUV);
+}
@@ -0,0 +1,27 @@
+#version 330
+
+// input, position is a normalized fraction of the static geometry bounds
+in vec2 vertexPosition;
+in vec4 vertexColor;
+
+// uniform block, shared by every program
+layout(std140) uniform Camera {
+    mat4 cameraMatrix;
+};
+
+// uniform, bounds of the whole static buffer
+uniform vec2 staticOrigin;
+uniform vec2 staticExtent;
+
+// output
+out vec4 fragmentColor;
+out vec2 fragmentPosition;
+
+void main() {
+    vec2 position = staticOrigin + vertexPosition * staticExtent;
+
+    gl_Position = cameraMatrix * vec4(position, 0.0f, 1.0f);
+
+    fragmentColor = vertexColor;
+    fragmentPosition = position;
+}
@@ -0,0 +1,17 @@
+#version 330
+
+// input
+in vec2 fragmentUV;
+in vec4 fragmentColor;
+flat in float fragmentLayer;
+
+// output
+out vec4 color;
+
+// uniform, every texture of the same size is one layer
+uniform sampler2DArray asset;
+
+void main() {
+    vec4 textureColor = texture(asset, vec3(fragmentUV, fragmentLayer));
+    color = fragmentColor * textureColor;
+}
@@ -0,0 +1,27 @@
+#version 330
+
+// input
+in vec2 fragmentPosition;
+in vec2 fragmentUV;
+in vec4 fragmentColor;
+flat in float fragmentLayer;
+
+// output
+out vec4 color;
+
+// uniform
+uniform vec2 visionCenter;
+uniform float visionRadius;
+uniform float intensity;
+
+// texture uniform, every texture of the same size is one layer
+uniform sampler2DArray asset;
+
+void main() {
+    vec4 textureColor = texture(asset, vec3(fragmentUV, fragmentLayer));
+
+    float dist = length(fragmentPosition - visionCenter) / visionRadius;
+    float factor = pow(0.01f, dist) - 0.01f;
+    // texture fades with the light like vision geometry does
+    color = fragmentColor * textureColor * factor * intensity;
+}
@@ -21,8 +21,8 @@ void main() {
 
     float dist = length(fragmentPosition - visionCenter) / visionRadius;
     float factor = pow(0.01f, dist) - 0.01f;
+    // texture fades with the light like vision geometry does
     color = fragmentColor * textureColor * factor * intensity;
-    color = fragmentColor * textureColor;
 
     // if another texture is closer than (visionRadius * 0.5f) units, than render it
     // if(dist < visionRadius * 0.5f){
@@ -5,8 +5,10 @@ in vec2 vertexPosition;
 in vec4 vertexColor;
 in vec2 vertexUV;
 
-// uniform
-uniform mat4 cameraMatrix;
+// uniform block, shared by every program
+layout(std140) uniform Camera {
+    mat4 cameraMatrix;
+};
 
 // output
 out vec2 fragmentPosition;
@@ -3,11 +3,18 @@
 #include "SocketException.h"
 #include "IOErrors.h"
 
+std::atomic<long long> InputStream::receivedBytes(0);
+
 InputStream::InputStream(SOCKET socket) : socket(socket)
 {
 
 }
 
+long long InputStream::getReceivedBytes()
+{
+	return receivedBytes.load(std::memory_order_relaxed);
+}
+
 byte InputStream::readByte()
 {
 	int length = sizeof(byte);
@@ -124,6 +131,7 @@ void InputStream::readData(byte* bytes, int lenght, std::string error)
 		}
 		else
 		{
+			receivedBytes.fetch_add(amount, std::memory_order_relaxed);
 			lenght = lenght - amount;
 			bytes = bytes + amount;
 		}
@@ -4,15 +4,20 @@
 
 #include <winsock.h>
 #include <string>
+#include <atomic>
 
 	class InputStream
 	{
 	private:
+		static std::atomic<long long> receivedBytes;
 		SOCKET socket;
 
 	public:
 		InputStream(SOCKET);
 
+		// bytes received by every stream since start
+		static long long getReceivedBytes();
+
 		byte readByte();
 		int readInt();
 		float readFloat();
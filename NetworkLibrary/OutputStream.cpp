@@ -3,6 +3,8 @@
 #include "SocketException.h"
 #include "IOErrors.h"
 
+std::atomic<long long> OutputStream::sentBytes(0);
+
 OutputStream::OutputStream(SOCKET socket) : socket(socket), offset(0), maxSize(capacity)
 {
 	bytes = new byte[maxSize];
@@ -108,6 +110,7 @@ void OutputStream::flush()
 			throw SocketException(OUTPUT_STREAM_ERROR);
 		}
 		else {
+			sentBytes.fetch_add(amount, std::memory_order_relaxed);
 			lenght = lenght - amount;
 			data = data + amount;
 		}
@@ -118,6 +121,11 @@ void OutputStream::flush()
 	offset = 0;
 }
 
+long long OutputStream::getSentBytes()
+{
+	return sentBytes.load(std::memory_order_relaxed);
+}
+
 void OutputStream::extend()
 {
 	maxSize = maxSize + increment;
@@ -4,12 +4,14 @@
 
 #include <winsock.h>
 #include <string>
+#include <atomic>
 #define capacity 4080
 #define increment 1080
 
 	class OutputStream
 	{
 	private:
+		static std::atomic<long long> sentBytes;
 		SOCKET socket;
 		byte* bytes;
 		int offset;
@@ -25,6 +27,9 @@
 		void writeUTF8(std::string);
 		void flush();
 
+		// bytes sent by every stream since start
+		static long long getSentBytes();
+
 	private:
 		int size(const char*);
 		void extend();